@@ -48,21 +48,90 @@ auto ConstraintChecker::check_data(
     return true;
 }
 
+auto ConstraintChecker::check_columns(
+    const std::vector<Column>& columns,
+    const Table& table
+) -> bool {
+    for (int i = 0; i < columns.size(); i++) {
+
+        const auto& column = columns.at(i);
+
+        for (const auto& constraint : table.column_constraints.at(i)) {
+            switch (constraint) {
+                case Constraint::NOT_NULL: {
+                    for (auto position = std::size_t{0}; position < column.size(); ++position) {
+                        if (column.is_null(position)) {
+                            fmt::println("Can't insert NULL data to column with NOT_NULL constraint!");
+                            return false;
+                        }
+                    }
+                } break;
+
+                case Constraint::UNIQUE: {
+                    if (!is_unique(column, table, i)) {
+                        fmt::println("Can't insert not unique data to column with UNIQUE constraint!");
+                        return false;
+                    }
+                } break;
+
+                case Constraint::PRIMARY_KEY: {
+                    for (auto position = std::size_t{0}; position < column.size(); ++position) {
+                        if (column.is_null(position)) {
+                            fmt::println("Can't insert not unique or NULL data to column with PRIMARY_KEY constraint!");
+                            return false;
+                        }
+                    }
+
+                    if (!is_unique(column, table, i)) {
+                        fmt::println("Can't insert not unique or NULL data to column with PRIMARY_KEY constraint!");
+                        return false;
+                    }
+                } break;
+
+                case Constraint::FOREIGN_KEY: {
+                    for (auto position = std::size_t{0}; position < column.size(); ++position) {
+                        if (!is_foreign_key(column.get_value(position), table, i)) {
+                            fmt::println("Can't insert data that violates FOREIGN KEY constraint!");
+                            return false;
+                        }
+                    }
+                } break;
+            }
+        }
+    }
+
+    return true;
+}
+
 auto ConstraintChecker::is_null(const std::string &element) -> bool {
     return element.empty();
 }
 
 auto ConstraintChecker::is_unique(const std::string& searched_element, const Table& table, const int& column_number) -> bool {
-    for (const auto& row : table.rows) {
-        const auto& column_element = row.at(column_number);
+    if (is_null(searched_element)) return true;
+
+    if (const auto& index = table.unique_indexes.at(column_number)) return !index->contains(searched_element);
+
+    return !table.columns.at(column_number).contains(searched_element);
+}
+
+auto ConstraintChecker::is_unique(const Column& column, const Table& table, const int& column_number) -> bool {
+    const auto& index = table.unique_indexes.at(column_number);
+    auto batch_index = HashIndex(column.type);
+
+    for (auto position = std::size_t{0}; position < column.size(); ++position) {
+        if (column.is_null(position)) continue;
 
-        if (column_element == searched_element) return false;
+        const auto exists = index ?
+            index->contains(column, position) :
+            table.columns.at(column_number).contains(column.get_value(position));
+
+        if (exists || !batch_index.insert(column, position, position)) return false;
     }
 
     return true;
 }
 
-
 auto ConstraintChecker::is_primary_key(const std::string& element, const Table& table, const int& column_number) -> bool {
     return !is_null(element) && is_unique(element, table, column_number);
 }
@@ -73,11 +142,11 @@ auto ConstraintChecker::is_foreign_key(const std::string& element, const Table&
     const auto& foreign_column_name = table.column_foreign_keys.at(column_number).second;
     const auto& foreign_column_index = Table::find_index(foreign_table->column_names, foreign_column_name);
 
-    for (const auto& row: foreign_table->get_all_data()) {
-        const auto& column_element = row.at(foreign_column_index);
-        if (column_element == element) return true;
-    }
-    return false;
+    if (foreign_column_index == -1) return false;
+
+    if (const auto& index = foreign_table->unique_indexes.at(foreign_column_index)) return index->contains(element);
+
+    return foreign_table->columns.at(foreign_column_index).contains(element);
 }
 
 
@@ -12,9 +12,15 @@ public:
         const Table& table
     ) -> bool;
 
+    static auto check_columns(
+        const std::vector<Column>& columns,
+        const Table& table
+    ) -> bool;
+
 private:
     static auto is_null(const std::string& element) -> bool;
     static auto is_unique(const std::string& searched_element, const Table& table, const int& column_number) -> bool;
     static auto is_primary_key(const std::string& element, const Table& table, const int& column_number) -> bool;
+    static auto is_unique(const Column& column, const Table& table, const int& column_number) -> bool;
     static auto is_foreign_key(const std::string& element, const Table& table, const int& column_number) -> bool;
 };
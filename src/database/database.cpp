@@ -60,6 +60,18 @@ auto Database::insert_data(const std::string& table_name, const std::vector<std:
     tables.at(table_name).insert_row(data);
 }
 
+auto Database::insert_data(const std::string& table_name, const std::vector<std::vector<std::string>>& rows) -> void {
+
+    if (!tables.contains(table_name)) {
+        fmt::println("Table with name '{}' does not exist in database with name: '{}'!", table_name, this->name);
+        return;
+    }
+
+    if (const auto inserted_rows = tables.at(table_name).insert_rows(rows); inserted_rows > 0) {
+        fmt::println("Successfully inserted {} rows into table: '{}'", inserted_rows, table_name);
+    }
+}
+
 auto Database::get_table_by_name(const std::string& table_name) -> Table& {
 
     if (!tables.contains(table_name)) {
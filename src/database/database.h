@@ -35,6 +35,11 @@ public:
         const std::vector<std::string>& data
     ) -> void;
 
+    auto insert_data(
+        const std::string& table_name,
+        const std::vector<std::vector<std::string>>& rows
+    ) -> void;
+
     auto get_table_by_name(
         const std::string& table_name
     ) -> Table&;
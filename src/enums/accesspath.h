@@ -0,0 +1,17 @@
+#pragma once
+
+#include <string>
+
+enum class AccessPath {
+    FULL_SCAN,
+    UNIQUE_INDEX,
+    ORDERED_INDEX
+};
+
+inline auto access_path_to_string(const AccessPath access_path) -> std::string {
+    switch (access_path) {
+        case AccessPath::UNIQUE_INDEX: return "unique index";
+        case AccessPath::ORDERED_INDEX: return "ordered index";
+        default: return "full scan";
+    }
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <string_view>
+
+enum class AggregateFunction {
+    NONE,
+    COUNT,
+    SUM,
+    AVG,
+    MIN,
+    MAX
+};
+
+inline auto aggregate_function_to_string(const AggregateFunction aggregate_function) -> std::string_view {
+    switch (aggregate_function) {
+        case AggregateFunction::COUNT: return "COUNT";
+        case AggregateFunction::SUM: return "SUM";
+        case AggregateFunction::AVG: return "AVG";
+        case AggregateFunction::MIN: return "MIN";
+        case AggregateFunction::MAX: return "MAX";
+        default: return "";
+    }
+}
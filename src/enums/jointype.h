@@ -1,8 +1,19 @@
 #pragma once
 
+#include <string>
+
 enum class JoinType {
     INNER,
     LEFT,
     RIGHT,
     FULL
-};
\ No newline at end of file
+};
+
+inline auto join_type_to_string(const JoinType join_type) -> std::string {
+    switch (join_type) {
+        case JoinType::LEFT: return "LEFT";
+        case JoinType::RIGHT: return "RIGHT";
+        case JoinType::FULL: return "FULL";
+        default: return "INNER";
+    }
+}
\ No newline at end of file
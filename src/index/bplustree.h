@@ -0,0 +1,170 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <utility>
+#include <vector>
+
+template <typename Key>
+class BPlusTree {
+public:
+    using Entry = std::pair<Key, std::size_t>;
+
+    auto insert(const Key& key, const std::size_t row_id) -> void {
+        if (nodes.empty()) nodes.emplace_back();
+
+        const auto split = insert_into(root, Entry{key, row_id});
+        if (!split) return;
+
+        auto new_root = Node{};
+        new_root.is_leaf = false;
+        new_root.entries.push_back(split->first);
+        new_root.children = {root, split->second};
+        nodes.push_back(std::move(new_root));
+        root = nodes.size() - 1;
+    }
+
+    auto erase(const Key& key, const std::size_t row_id) -> void {
+        if (nodes.empty()) return;
+
+        const auto entry = Entry{key, row_id};
+        auto& entries = nodes[find_leaf(entry)].entries;
+        const auto it = std::ranges::lower_bound(entries, entry);
+
+        if (it != entries.end() && *it == entry) {
+            entries.erase(it);
+            --entries_number;
+        }
+    }
+
+    auto clear() -> void {
+        nodes.clear();
+        root = 0;
+        entries_number = 0;
+    }
+
+    [[nodiscard]] auto size() const -> std::size_t {
+        return entries_number;
+    }
+
+    [[nodiscard]] auto range(
+        const std::optional<Key>& lower,
+        const bool lower_inclusive,
+        const std::optional<Key>& upper,
+        const bool upper_inclusive
+    ) const -> std::vector<std::size_t> {
+        auto row_ids = std::vector<std::size_t>{};
+        if (nodes.empty()) return row_ids;
+
+        auto leaf = lower ? find_leaf(Entry{*lower, 0}) : leftmost_leaf();
+
+        for (; leaf != no_node; leaf = nodes[leaf].next) {
+            for (const auto& [key, row_id] : nodes[leaf].entries) {
+                if (lower && (key < *lower || (!lower_inclusive && !(*lower < key)))) continue;
+                if (upper && (*upper < key || (!upper_inclusive && !(key < *upper)))) return row_ids;
+
+                row_ids.push_back(row_id);
+            }
+        }
+
+        return row_ids;
+    }
+
+private:
+    static constexpr std::size_t max_entries = 64;
+    static constexpr std::size_t no_node = std::numeric_limits<std::size_t>::max();
+
+    struct Node {
+        bool is_leaf = true;
+        std::vector<Entry> entries;
+        std::vector<std::size_t> children;
+        std::size_t next = no_node;
+    };
+
+    std::vector<Node> nodes;
+    std::size_t root = 0;
+    std::size_t entries_number = 0;
+
+    auto insert_into(const std::size_t node_index, const Entry& entry) -> std::optional<std::pair<Entry, std::size_t>> {
+        if (nodes[node_index].is_leaf) {
+            auto& entries = nodes[node_index].entries;
+            const auto it = std::ranges::lower_bound(entries, entry);
+
+            if (it != entries.end() && *it == entry) return std::nullopt;
+
+            entries.insert(it, entry);
+            ++entries_number;
+
+            if (entries.size() <= max_entries) return std::nullopt;
+            return split_leaf(node_index);
+        }
+
+        const auto child_slot = child_slot_for(nodes[node_index], entry);
+        const auto split = insert_into(nodes[node_index].children[child_slot], entry);
+
+        if (!split) return std::nullopt;
+
+        auto& node = nodes[node_index];
+        node.entries.insert(node.entries.begin() + child_slot, split->first);
+        node.children.insert(node.children.begin() + child_slot + 1, split->second);
+
+        if (node.entries.size() <= max_entries) return std::nullopt;
+        return split_internal(node_index);
+    }
+
+    auto split_leaf(const std::size_t node_index) -> std::pair<Entry, std::size_t> {
+        auto right = Node{};
+        auto& left = nodes[node_index];
+        const auto middle = left.entries.size() / 2;
+
+        right.entries.assign(left.entries.begin() + middle, left.entries.end());
+        left.entries.resize(middle);
+        right.next = left.next;
+
+        nodes.push_back(std::move(right));
+        nodes[node_index].next = nodes.size() - 1;
+
+        return {nodes.back().entries.front(), nodes.size() - 1};
+    }
+
+    auto split_internal(const std::size_t node_index) -> std::pair<Entry, std::size_t> {
+        auto right = Node{};
+        auto& left = nodes[node_index];
+        const auto middle = left.entries.size() / 2;
+        const auto separator = left.entries[middle];
+
+        right.is_leaf = false;
+        right.entries.assign(left.entries.begin() + middle + 1, left.entries.end());
+        right.children.assign(left.children.begin() + middle + 1, left.children.end());
+        left.entries.resize(middle);
+        left.children.resize(middle + 1);
+
+        nodes.push_back(std::move(right));
+
+        return {separator, nodes.size() - 1};
+    }
+
+    [[nodiscard]] static auto child_slot_for(const Node& node, const Entry& entry) -> std::size_t {
+        return std::ranges::upper_bound(node.entries, entry) - node.entries.begin();
+    }
+
+    [[nodiscard]] auto find_leaf(const Entry& entry) const -> std::size_t {
+        auto node_index = root;
+
+        while (!nodes[node_index].is_leaf) {
+            node_index = nodes[node_index].children[child_slot_for(nodes[node_index], entry)];
+        }
+
+        return node_index;
+    }
+
+    [[nodiscard]] auto leftmost_leaf() const -> std::size_t {
+        auto node_index = root;
+
+        while (!nodes[node_index].is_leaf) node_index = nodes[node_index].children.front();
+
+        return node_index;
+    }
+};
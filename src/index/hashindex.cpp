@@ -0,0 +1,92 @@
+#include "hashindex.h"
+
+auto HashIndex::find(const std::string& value) const -> std::optional<std::size_t> {
+    switch (type) {
+        case ColumnType::INTEGER: {
+            auto integer_value = std::int64_t{0};
+            if (!Column::parse_integer(value, integer_value)) return std::nullopt;
+
+            const auto it = integer_keys.find(integer_value);
+            if (it == integer_keys.end()) return std::nullopt;
+            return it->second;
+        }
+
+        case ColumnType::FLOAT: {
+            auto float_value = 0.0;
+            if (!Column::parse_float(value, float_value)) return std::nullopt;
+
+            const auto it = float_keys.find(float_value);
+            if (it == float_keys.end()) return std::nullopt;
+            return it->second;
+        }
+
+        default: {
+            if (value.empty()) return std::nullopt;
+
+            const auto it = text_keys.find(std::string_view(value));
+            if (it == text_keys.end()) return std::nullopt;
+            return it->second;
+        }
+    }
+}
+
+auto HashIndex::contains(const std::string& value) const -> bool {
+    return find(value).has_value();
+}
+
+auto HashIndex::contains(const Column& column, const std::size_t position) const -> bool {
+    if (column.is_null(position)) return false;
+
+    switch (type) {
+        case ColumnType::INTEGER: return integer_keys.contains(column.get_integer(position));
+        case ColumnType::FLOAT: return float_keys.contains(column.get_float(position));
+        default: return text_keys.contains(column.get_text(position));
+    }
+}
+
+auto HashIndex::insert(const Column& column, const std::size_t position, const std::size_t row_id) -> bool {
+    if (column.is_null(position)) return true;
+
+    switch (type) {
+        case ColumnType::INTEGER: return integer_keys.emplace(column.get_integer(position), row_id).second;
+        case ColumnType::FLOAT: return float_keys.emplace(column.get_float(position), row_id).second;
+        default: return text_keys.emplace(std::string(column.get_text(position)), row_id).second;
+    }
+}
+
+auto HashIndex::erase(const Column& column, const std::size_t position) -> void {
+    if (column.is_null(position)) return;
+
+    switch (type) {
+        case ColumnType::INTEGER: integer_keys.erase(column.get_integer(position)); break;
+        case ColumnType::FLOAT: float_keys.erase(column.get_float(position)); break;
+        default: {
+            if (const auto it = text_keys.find(column.get_text(position)); it != text_keys.end()) text_keys.erase(it);
+        } break;
+    }
+}
+
+auto HashIndex::build(const Column& column, const std::vector<std::size_t>& row_ids) -> bool {
+    clear();
+
+    switch (type) {
+        case ColumnType::INTEGER: integer_keys.reserve(column.size()); break;
+        case ColumnType::FLOAT: float_keys.reserve(column.size()); break;
+        default: text_keys.reserve(column.size()); break;
+    }
+
+    for (auto i = std::size_t{0}; i < column.size(); ++i) {
+        if (!insert(column, i, row_ids[i])) {
+            clear();
+            return false;
+        }
+    }
+
+    return true;
+}
+
+auto HashIndex::clear() -> void {
+    integer_keys.clear();
+    float_keys.clear();
+    text_keys.clear();
+}
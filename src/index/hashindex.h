@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "../enums/columntype.h"
+#include "../table/column.h"
+
+class HashIndex {
+public:
+    ColumnType type = ColumnType::INVALID;
+
+    HashIndex() = default;
+
+    explicit HashIndex(const ColumnType type) : type(type) {}
+
+    [[nodiscard]] auto find(const std::string& value) const -> std::optional<std::size_t>;
+
+    [[nodiscard]] auto contains(const std::string& value) const -> bool;
+
+    [[nodiscard]] auto contains(const Column& column, std::size_t position) const -> bool;
+
+    auto insert(const Column& column, std::size_t position, std::size_t row_id) -> bool;
+
+    auto erase(const Column& column, std::size_t position) -> void;
+
+    auto build(const Column& column, const std::vector<std::size_t>& row_ids) -> bool;
+
+    auto clear() -> void;
+
+private:
+    std::unordered_map<std::int64_t, std::size_t> integer_keys;
+    std::unordered_map<double, std::size_t> float_keys;
+    std::unordered_map<std::string, std::size_t, StringHash, std::equal_to<>> text_keys;
+};
@@ -0,0 +1,105 @@
+#include "orderedindex.h"
+
+auto OrderedIndex::find(
+    const std::string& comparison_operator,
+    const std::string& value
+) const -> std::optional<std::vector<std::size_t>> {
+    switch (type) {
+        case ColumnType::INTEGER: {
+            auto integer_value = std::int64_t{0};
+            if (!Column::parse_integer(value, integer_value)) return std::nullopt;
+            return find_in(integer_tree, comparison_operator, integer_value);
+        }
+
+        case ColumnType::FLOAT: {
+            auto float_value = 0.0;
+            if (!Column::parse_float(value, float_value)) return std::nullopt;
+            return find_in(float_tree, comparison_operator, float_value);
+        }
+
+        default:
+            return find_in(text_tree, comparison_operator, value);
+    }
+}
+
+auto OrderedIndex::size() const -> std::size_t {
+    switch (type) {
+        case ColumnType::INTEGER: return integer_tree.size();
+        case ColumnType::FLOAT: return float_tree.size();
+        default: return text_tree.size();
+    }
+}
+
+auto OrderedIndex::is_supported_operator(const std::string& comparison_operator) -> bool {
+    return comparison_operator == "=" || comparison_operator == ">" || comparison_operator == ">=" ||
+        comparison_operator == "<" || comparison_operator == "<=";
+}
+
+auto OrderedIndex::get_ordered_row_ids() const -> std::vector<std::size_t> {
+    switch (type) {
+        case ColumnType::INTEGER: return integer_tree.range(std::nullopt, false, std::nullopt, false);
+        case ColumnType::FLOAT: return float_tree.range(std::nullopt, false, std::nullopt, false);
+        default: return text_tree.range(std::nullopt, false, std::nullopt, false);
+    }
+}
+
+auto OrderedIndex::insert(const Column& column, const std::size_t position, const std::size_t row_id) -> void {
+    switch (type) {
+        case ColumnType::INTEGER: {
+            if (!column.is_null(position)) integer_tree.insert(column.get_integer(position), row_id);
+        } break;
+
+        case ColumnType::FLOAT: {
+            if (!column.is_null(position)) float_tree.insert(column.get_float(position), row_id);
+        } break;
+
+        default:
+            text_tree.insert(std::string(column.get_text(position)), row_id);
+    }
+}
+
+auto OrderedIndex::erase(const Column& column, const std::size_t position, const std::size_t row_id) -> void {
+    switch (type) {
+        case ColumnType::INTEGER: {
+            if (!column.is_null(position)) integer_tree.erase(column.get_integer(position), row_id);
+        } break;
+
+        case ColumnType::FLOAT: {
+            if (!column.is_null(position)) float_tree.erase(column.get_float(position), row_id);
+        } break;
+
+        default:
+            text_tree.erase(std::string(column.get_text(position)), row_id);
+    }
+}
+
+auto OrderedIndex::build(const Column& column, const std::vector<std::size_t>& row_ids) -> void {
+    clear();
+
+    for (auto i = std::size_t{0}; i < column.size(); ++i) insert(column, i, row_ids[i]);
+}
+
+auto OrderedIndex::clear() -> void {
+    integer_tree.clear();
+    float_tree.clear();
+    text_tree.clear();
+}
+
+template <typename Key>
+auto OrderedIndex::find_in(
+    const BPlusTree<Key>& tree,
+    const std::string& comparison_operator,
+    const Key& key
+) -> std::optional<std::vector<std::size_t>> {
+    auto row_ids = std::optional<std::vector<std::size_t>>{};
+
+    if (comparison_operator == "=") row_ids = tree.range(key, true, key, true);
+    else if (comparison_operator == ">") row_ids = tree.range(key, false, std::nullopt, false);
+    else if (comparison_operator == ">=") row_ids = tree.range(key, true, std::nullopt, false);
+    else if (comparison_operator == "<") row_ids = tree.range(std::nullopt, false, key, false);
+    else if (comparison_operator == "<=") row_ids = tree.range(std::nullopt, false, key, true);
+    else return std::nullopt;
+
+    std::ranges::sort(*row_ids);
+    return row_ids;
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "bplustree.h"
+#include "../enums/columntype.h"
+#include "../table/column.h"
+
+class OrderedIndex {
+public:
+    ColumnType type = ColumnType::INVALID;
+
+    OrderedIndex() = default;
+
+    explicit OrderedIndex(const ColumnType type) : type(type) {}
+
+    [[nodiscard]] auto find(
+        const std::string& comparison_operator,
+        const std::string& value
+    ) const -> std::optional<std::vector<std::size_t>>;
+
+    [[nodiscard]] auto size() const -> std::size_t;
+
+    [[nodiscard]] static auto is_supported_operator(const std::string& comparison_operator) -> bool;
+
+    [[nodiscard]] auto get_ordered_row_ids() const -> std::vector<std::size_t>;
+
+    auto insert(const Column& column, std::size_t position, std::size_t row_id) -> void;
+
+    auto erase(const Column& column, std::size_t position, std::size_t row_id) -> void;
+
+    auto build(const Column& column, const std::vector<std::size_t>& row_ids) -> void;
+
+    auto clear() -> void;
+
+private:
+    BPlusTree<std::int64_t> integer_tree;
+    BPlusTree<double> float_tree;
+    BPlusTree<std::string> text_tree;
+
+    template <typename Key>
+    static auto find_in(
+        const BPlusTree<Key>& tree,
+        const std::string& comparison_operator,
+        const Key& key
+    ) -> std::optional<std::vector<std::size_t>>;
+};
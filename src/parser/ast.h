@@ -0,0 +1,148 @@
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "../enums/aggregatefunction.h"
+#include "../enums/jointype.h"
+
+enum class ExpressionType {
+    CONDITION,
+    AND,
+    OR
+};
+
+struct ColumnReference {
+    std::string table_name;
+    std::string column_name;
+
+    [[nodiscard]] auto full_name() const -> std::string {
+        return table_name.empty() ? column_name : table_name + "." + column_name;
+    }
+};
+
+struct Condition {
+    ColumnReference column;
+    std::string comparison_operator;
+    std::string value;
+    bool is_parameter = false;
+};
+
+struct Expression {
+    ExpressionType type = ExpressionType::CONDITION;
+    Condition condition;
+    std::size_t left = 0;
+    std::size_t right = 0;
+};
+
+struct WhereClause {
+    std::vector<Expression> expressions;
+    std::size_t root = 0;
+
+    [[nodiscard]] auto get_conjuncts() const -> std::vector<std::size_t> {
+        auto conjuncts = std::vector<std::size_t>{};
+        auto pending = std::vector<std::size_t>{root};
+
+        while (!pending.empty()) {
+            const auto index = pending.back();
+            pending.pop_back();
+
+            if (expressions[index].type != ExpressionType::AND) {
+                conjuncts.push_back(index);
+                continue;
+            }
+
+            pending.push_back(expressions[index].right);
+            pending.push_back(expressions[index].left);
+        }
+
+        return conjuncts;
+    }
+
+    [[nodiscard]] auto get_conditions(const std::size_t index) const -> std::vector<std::size_t> {
+        const auto& expression = expressions[index];
+        if (expression.type == ExpressionType::CONDITION) return {index};
+
+        auto conditions = get_conditions(expression.left);
+        const auto right_conditions = get_conditions(expression.right);
+        conditions.insert(conditions.end(), right_conditions.begin(), right_conditions.end());
+
+        return conditions;
+    }
+
+    [[nodiscard]] auto to_string(const std::size_t index) const -> std::string {
+        const auto& expression = expressions[index];
+
+        if (expression.type == ExpressionType::CONDITION) {
+            const auto& [column, comparison_operator, value, is_parameter] = expression.condition;
+            return column.full_name() + " " + comparison_operator + " " + value;
+        }
+
+        const auto separator = expression.type == ExpressionType::AND ? " AND " : " OR ";
+        return "(" + to_string(expression.left) + separator + to_string(expression.right) + ")";
+    }
+
+    template <typename ConditionEvaluator>
+    [[nodiscard]] auto evaluate(const ConditionEvaluator& evaluate_condition) const -> bool {
+        return evaluate(root, evaluate_condition);
+    }
+
+    template <typename ConditionEvaluator>
+    [[nodiscard]] auto evaluate(const std::size_t index, const ConditionEvaluator& evaluate_condition) const -> bool {
+        const auto& expression = expressions[index];
+
+        switch (expression.type) {
+            case ExpressionType::AND:
+                return evaluate(expression.left, evaluate_condition) && evaluate(expression.right, evaluate_condition);
+            case ExpressionType::OR:
+                return evaluate(expression.left, evaluate_condition) || evaluate(expression.right, evaluate_condition);
+            default:
+                return evaluate_condition(index);
+        }
+    }
+};
+
+struct JoinClause {
+    JoinType type = JoinType::INNER;
+    std::string table_name;
+    ColumnReference left;
+    ColumnReference right;
+};
+
+struct SelectedColumn {
+    ColumnReference column;
+    AggregateFunction aggregate = AggregateFunction::NONE;
+};
+
+struct OrderByItem {
+    ColumnReference column;
+    bool is_descending = false;
+};
+
+struct SelectStatement {
+    bool is_distinct = false;
+    bool is_select_all = false;
+    std::vector<SelectedColumn> columns;
+    std::vector<std::string> table_names;
+    std::vector<JoinClause> joins;
+    std::optional<WhereClause> where;
+    std::vector<ColumnReference> group_by;
+    std::vector<OrderByItem> order_by;
+    std::optional<std::size_t> limit;
+    std::size_t offset = 0;
+
+    [[nodiscard]] auto is_aggregate() const -> bool {
+        return !group_by.empty() || std::ranges::any_of(columns, [](const SelectedColumn& column) {
+            return column.aggregate != AggregateFunction::NONE;
+        });
+    }
+
+    [[nodiscard]] auto get_row_bound() const -> std::size_t {
+        if (!limit) return std::numeric_limits<std::size_t>::max();
+
+        return offset + std::min(*limit, std::numeric_limits<std::size_t>::max() - offset);
+    }
+};
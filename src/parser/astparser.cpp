@@ -0,0 +1,376 @@
+#include "astparser.h"
+
+#include <charconv>
+#include <fmt/ranges.h>
+
+auto AstParser::parse_select() -> std::optional<SelectStatement> {
+    auto statement = SelectStatement{};
+
+    if (!accept("SELECT")) {
+        fmt::println("Query should start with SELECT clause!");
+        return std::nullopt;
+    }
+
+    if (accept("DISTINCT")) statement.is_distinct = true;
+    if (accept("*")) statement.is_select_all = true;
+
+    while (!statement.is_select_all && peek().type != TokenType::END && !peek().is("FROM")) {
+        if (peek().type == TokenType::COMMA) {
+            advance();
+            continue;
+        }
+
+        const auto column = parse_selected_column();
+        if (!column) return std::nullopt;
+
+        statement.columns.push_back(*column);
+    }
+
+    if (!accept("FROM")) {
+        fmt::println("Query with SELECT clause should contain FROM clause!");
+        return std::nullopt;
+    }
+
+    if (!statement.is_select_all && statement.columns.empty()) {
+        fmt::println("Query with SELECT clause should contain column names!");
+        return std::nullopt;
+    }
+
+    while (peek().type != TokenType::END && !is_clause_keyword(peek())) {
+        if (advance().type == TokenType::COMMA) continue;
+
+        if (tokens.at(position - 1).type != TokenType::WORD) {
+            fmt::println("Unexpected token '{}' after FROM clause!", tokens.at(position - 1).text);
+            return std::nullopt;
+        }
+
+        statement.table_names.emplace_back(tokens.at(position - 1).text);
+    }
+
+    if (statement.table_names.empty()) {
+        fmt::println("Query with SELECT clause should contain table name after FROM clause!");
+        return std::nullopt;
+    }
+
+    while (to_join_type(peek())) {
+        const auto join = parse_join_clause();
+        if (!join) return std::nullopt;
+
+        statement.joins.push_back(*join);
+    }
+
+    if (accept("WHERE")) {
+        statement.where = parse_where_clause();
+        if (!statement.where) return std::nullopt;
+    }
+
+    if (accept("GROUP")) {
+        auto group_by = parse_group_by_clause();
+        if (!group_by) return std::nullopt;
+
+        statement.group_by = std::move(*group_by);
+    }
+
+    if (accept("ORDER")) {
+        auto order_by = parse_order_by_clause();
+        if (!order_by) return std::nullopt;
+
+        statement.order_by = std::move(*order_by);
+    }
+
+    if (accept("LIMIT")) {
+        statement.limit = parse_row_count("LIMIT");
+        if (!statement.limit) return std::nullopt;
+
+        if (accept("OFFSET")) {
+            const auto offset = parse_row_count("OFFSET");
+            if (!offset) return std::nullopt;
+
+            statement.offset = *offset;
+        }
+    }
+
+    if (peek().type != TokenType::END) {
+        fmt::println("Unexpected token '{}' in query with SELECT clause!", peek().text);
+        return std::nullopt;
+    }
+
+    return statement;
+}
+
+auto AstParser::parse_where() -> std::optional<WhereClause> {
+    auto where = parse_where_clause();
+    if (!where) return std::nullopt;
+
+    if (peek().type != TokenType::END) {
+        fmt::println("Unexpected token '{}' in WHERE clause!", peek().text);
+        return std::nullopt;
+    }
+
+    return where;
+}
+
+auto AstParser::peek() const -> const Token& {
+    return tokens.at(position);
+}
+
+auto AstParser::advance() -> const Token& {
+    const auto& token = tokens.at(position);
+    if (token.type != TokenType::END) ++position;
+
+    return token;
+}
+
+auto AstParser::accept(const std::string_view word) -> bool {
+    if (!peek().is(word)) return false;
+
+    advance();
+    return true;
+}
+
+auto AstParser::parse_column_reference() -> std::optional<ColumnReference> {
+    const auto& token = advance();
+
+    if (token.type != TokenType::WORD || is_clause_keyword(token)) {
+        fmt::println("Expected column name, but got '{}'!", token.text);
+        return std::nullopt;
+    }
+
+    const auto dot_position = token.text.find('.');
+    if (dot_position == std::string_view::npos) return ColumnReference{{}, std::string(token.text)};
+
+    return ColumnReference{std::string(token.text.substr(0, dot_position)), std::string(token.text.substr(dot_position + 1))};
+}
+
+auto AstParser::parse_selected_column() -> std::optional<SelectedColumn> {
+    const auto aggregate = to_aggregate_function(peek());
+
+    if (aggregate == AggregateFunction::NONE || tokens.at(position + 1).type != TokenType::LEFT_PARENTHESIS) {
+        const auto column = parse_column_reference();
+        if (!column) return std::nullopt;
+
+        return SelectedColumn{*column};
+    }
+
+    advance();
+    advance();
+
+    auto selected_column = SelectedColumn{{}, aggregate};
+
+    if (peek().is("*")) {
+        if (aggregate != AggregateFunction::COUNT) {
+            fmt::println("Only COUNT function accepts '*' as its argument!");
+            return std::nullopt;
+        }
+
+        selected_column.column.column_name = advance().text;
+    } else {
+        const auto column = parse_column_reference();
+        if (!column) return std::nullopt;
+
+        selected_column.column = *column;
+    }
+
+    if (advance().type != TokenType::RIGHT_PARENTHESIS) {
+        fmt::println("Expected ')' after argument of {} function!", aggregate_function_to_string(aggregate));
+        return std::nullopt;
+    }
+
+    return selected_column;
+}
+
+auto AstParser::parse_join_clause() -> std::optional<JoinClause> {
+    auto join = JoinClause{};
+    const auto& join_type_token = advance();
+    join.type = *to_join_type(join_type_token);
+
+    const auto& join_token = advance();
+    const auto& table_token = advance();
+
+    if (!join_token.is("JOIN") || table_token.type != TokenType::WORD || !accept("ON")) {
+        fmt::println("Query with SELECT and {} clause should contain JOIN and ON clauses!", join_type_token.text);
+        return std::nullopt;
+    }
+
+    join.table_name = table_token.text;
+
+    const auto left = parse_column_reference();
+    if (!left) return std::nullopt;
+
+    if (const auto& equality_token = advance(); equality_token.type != TokenType::OPERATOR || equality_token.text != "=") {
+        fmt::println("Condition after ON clause should compare columns with '=' operator!");
+        return std::nullopt;
+    }
+
+    const auto right = parse_column_reference();
+    if (!right) return std::nullopt;
+
+    join.left = *left;
+    join.right = *right;
+
+    return join;
+}
+
+auto AstParser::parse_where_clause() -> std::optional<WhereClause> {
+    auto where = WhereClause{};
+
+    const auto root = parse_or_expression(where);
+    if (!root) return std::nullopt;
+
+    where.root = *root;
+    return where;
+}
+
+auto AstParser::parse_or_expression(WhereClause& where) -> std::optional<std::size_t> {
+    auto left = parse_and_expression(where);
+    if (!left) return std::nullopt;
+
+    while (accept("OR") || accept("||")) {
+        const auto right = parse_and_expression(where);
+        if (!right) return std::nullopt;
+
+        where.expressions.push_back({ExpressionType::OR, {}, *left, *right});
+        left = where.expressions.size() - 1;
+    }
+
+    return left;
+}
+
+auto AstParser::parse_and_expression(WhereClause& where) -> std::optional<std::size_t> {
+    auto left = parse_primary_expression(where);
+    if (!left) return std::nullopt;
+
+    while (accept("AND") || accept("&&")) {
+        const auto right = parse_primary_expression(where);
+        if (!right) return std::nullopt;
+
+        where.expressions.push_back({ExpressionType::AND, {}, *left, *right});
+        left = where.expressions.size() - 1;
+    }
+
+    return left;
+}
+
+auto AstParser::parse_primary_expression(WhereClause& where) -> std::optional<std::size_t> {
+    if (peek().type == TokenType::LEFT_PARENTHESIS) {
+        advance();
+
+        const auto expression = parse_or_expression(where);
+        if (!expression) return std::nullopt;
+
+        if (advance().type != TokenType::RIGHT_PARENTHESIS) {
+            fmt::println("Expected ')' to close condition group in WHERE clause!");
+            return std::nullopt;
+        }
+
+        return expression;
+    }
+
+    const auto condition = parse_condition();
+    if (!condition) return std::nullopt;
+
+    where.expressions.push_back({ExpressionType::CONDITION, *condition});
+    return where.expressions.size() - 1;
+}
+
+auto AstParser::parse_condition() -> std::optional<Condition> {
+    const auto column = parse_column_reference();
+    if (!column) return std::nullopt;
+
+    const auto& operator_token = advance();
+
+    if (operator_token.type != TokenType::OPERATOR && !operator_token.is("LIKE")) {
+        fmt::println("Expected comparison operator after column '{}', but got '{}'!", column->full_name(), operator_token.text);
+        return std::nullopt;
+    }
+
+    const auto& value_token = advance();
+
+    if (value_token.type != TokenType::WORD && value_token.type != TokenType::STRING) {
+        fmt::println("Expected value after comparison operator '{}'!", operator_token.text);
+        return std::nullopt;
+    }
+
+    const auto is_parameter = value_token.type == TokenType::WORD && value_token.text == "?";
+
+    return Condition{*column, std::string(operator_token.text), std::string(value_token.text), is_parameter};
+}
+
+auto AstParser::parse_group_by_clause() -> std::optional<std::vector<ColumnReference>> {
+    if (!accept("BY")) {
+        fmt::println("Query with GROUP clause should contain BY clause!");
+        return std::nullopt;
+    }
+
+    auto group_by = std::vector<ColumnReference>{};
+
+    while (true) {
+        const auto column = parse_column_reference();
+        if (!column) return std::nullopt;
+
+        group_by.push_back(*column);
+
+        if (peek().type != TokenType::COMMA) return group_by;
+        advance();
+    }
+}
+
+auto AstParser::parse_order_by_clause() -> std::optional<std::vector<OrderByItem>> {
+    if (!accept("BY")) {
+        fmt::println("Query with ORDER clause should contain BY clause!");
+        return std::nullopt;
+    }
+
+    auto order_by = std::vector<OrderByItem>{};
+
+    while (true) {
+        const auto column = parse_column_reference();
+        if (!column) return std::nullopt;
+
+        const auto is_descending = accept("DESC");
+        if (!is_descending) accept("ASC");
+
+        order_by.push_back({*column, is_descending});
+
+        if (peek().type != TokenType::COMMA) return order_by;
+        advance();
+    }
+}
+
+auto AstParser::parse_row_count(const std::string_view clause) -> std::optional<std::size_t> {
+    const auto& token = advance();
+    const auto end = token.text.data() + token.text.size();
+    auto row_count = std::size_t{0};
+    const auto [parsed_end, error] = std::from_chars(token.text.data(), end, row_count);
+
+    if (token.type != TokenType::WORD || error != std::errc{} || parsed_end != end) {
+        fmt::println("Expected non-negative row count after {} clause, but got '{}'!", clause, token.text);
+        return std::nullopt;
+    }
+
+    return row_count;
+}
+
+auto AstParser::is_clause_keyword(const Token& token) -> bool {
+    return token.is("FROM") || token.is("WHERE") || token.is("JOIN") || token.is("ON") || token.is("GROUP") || token.is("ORDER") || token.is("LIMIT") || token.is("OFFSET") ||
+        token.is("AND") || token.is("OR") || token.is("&&") || token.is("||") || to_join_type(token);
+}
+
+auto AstParser::to_join_type(const Token& token) -> std::optional<JoinType> {
+    if (token.is("INNER")) return JoinType::INNER;
+    if (token.is("LEFT")) return JoinType::LEFT;
+    if (token.is("RIGHT")) return JoinType::RIGHT;
+    if (token.is("FULL")) return JoinType::FULL;
+
+    return std::nullopt;
+}
+
+auto AstParser::to_aggregate_function(const Token& token) -> AggregateFunction {
+    if (token.is("COUNT")) return AggregateFunction::COUNT;
+    if (token.is("SUM")) return AggregateFunction::SUM;
+    if (token.is("AVG")) return AggregateFunction::AVG;
+    if (token.is("MIN")) return AggregateFunction::MIN;
+    if (token.is("MAX")) return AggregateFunction::MAX;
+
+    return AggregateFunction::NONE;
+}
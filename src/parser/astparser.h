@@ -0,0 +1,55 @@
+#pragma once
+
+#include <optional>
+#include <string_view>
+#include <vector>
+
+#include "ast.h"
+#include "lexer.h"
+
+class AstParser {
+public:
+    explicit AstParser(std::vector<Token> tokens) : tokens(std::move(tokens)) {}
+
+    auto parse_select() -> std::optional<SelectStatement>;
+
+    auto parse_where() -> std::optional<WhereClause>;
+
+private:
+    std::vector<Token> tokens;
+    std::size_t position = 0;
+
+    [[nodiscard]] auto peek() const -> const Token&;
+
+    auto advance() -> const Token&;
+
+    auto accept(std::string_view word) -> bool;
+
+    auto parse_column_reference() -> std::optional<ColumnReference>;
+
+    auto parse_selected_column() -> std::optional<SelectedColumn>;
+
+    auto parse_join_clause() -> std::optional<JoinClause>;
+
+    auto parse_where_clause() -> std::optional<WhereClause>;
+
+    auto parse_or_expression(WhereClause& where) -> std::optional<std::size_t>;
+
+    auto parse_and_expression(WhereClause& where) -> std::optional<std::size_t>;
+
+    auto parse_primary_expression(WhereClause& where) -> std::optional<std::size_t>;
+
+    auto parse_condition() -> std::optional<Condition>;
+
+    auto parse_group_by_clause() -> std::optional<std::vector<ColumnReference>>;
+
+    auto parse_order_by_clause() -> std::optional<std::vector<OrderByItem>>;
+
+    auto parse_row_count(std::string_view clause) -> std::optional<std::size_t>;
+
+    static auto is_clause_keyword(const Token& token) -> bool;
+
+    static auto to_join_type(const Token& token) -> std::optional<JoinType>;
+
+    static auto to_aggregate_function(const Token& token) -> AggregateFunction;
+};
@@ -0,0 +1,57 @@
+#include "lexer.h"
+
+#include <fmt/ranges.h>
+
+auto Lexer::tokenize() -> std::optional<std::vector<Token>> {
+    auto tokens = std::vector<Token>{};
+
+    while (position < query.size()) {
+        const auto character = query[position];
+        const auto next_character = position + 1 < query.size() ? query[position + 1] : '\0';
+
+        if (character == ' ' || character == '\t' || character == '\r' || character == '\n') {
+            ++position;
+        } else if (character == ',') {
+            tokens.push_back({TokenType::COMMA, query.substr(position++, 1)});
+        } else if (character == '(') {
+            tokens.push_back({TokenType::LEFT_PARENTHESIS, query.substr(position++, 1)});
+        } else if (character == ')') {
+            tokens.push_back({TokenType::RIGHT_PARENTHESIS, query.substr(position++, 1)});
+        } else if (character == '\'') {
+            const auto end = query.find('\'', position + 1);
+
+            if (end == std::string_view::npos) {
+                fmt::println("Query contains unclosed quote!");
+                return std::nullopt;
+            }
+
+            tokens.push_back({TokenType::STRING, query.substr(position + 1, end - position - 1)});
+            position = end + 1;
+        } else if ((character == '<' && next_character == '>') || ((character == '<' || character == '>' || character == '!') && next_character == '=')) {
+            tokens.push_back({TokenType::OPERATOR, query.substr(position, 2)});
+            position += 2;
+        } else if (character == '=' || character == '<' || character == '>') {
+            tokens.push_back({TokenType::OPERATOR, query.substr(position++, 1)});
+        } else {
+            const auto begin = position;
+            while (position < query.size() && !is_delimiter(query[position])) ++position;
+            if (position == begin) ++position;
+
+            tokens.push_back({TokenType::WORD, query.substr(begin, position - begin)});
+        }
+    }
+
+    tokens.push_back({TokenType::END, query.substr(query.size())});
+    return tokens;
+}
+
+auto Lexer::is_delimiter(const char character) -> bool {
+    switch (character) {
+        case ' ': case '\t': case '\r': case '\n':
+        case ',': case '(': case ')': case '\'':
+        case '=': case '<': case '>': case '!':
+            return true;
+        default:
+            return false;
+    }
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <optional>
+#include <string_view>
+#include <vector>
+
+enum class TokenType {
+    WORD,
+    STRING,
+    OPERATOR,
+    COMMA,
+    LEFT_PARENTHESIS,
+    RIGHT_PARENTHESIS,
+    END
+};
+
+struct Token {
+    TokenType type = TokenType::END;
+    std::string_view text;
+
+    [[nodiscard]] auto is(const std::string_view word) const -> bool {
+        return type == TokenType::WORD && text == word;
+    }
+};
+
+class Lexer {
+public:
+    explicit Lexer(const std::string_view query) : query(query) {}
+
+    auto tokenize() -> std::optional<std::vector<Token>>;
+
+private:
+    std::string_view query;
+    std::size_t position = 0;
+
+    static auto is_delimiter(char character) -> bool;
+};
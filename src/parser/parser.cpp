@@ -9,8 +9,11 @@
 
 #include "../serializer/serializer.h"
 #include "queries/alterparser.h"
+#include "queries/copyparser.h"
 #include "queries/deleteparser.h"
+#include "queries/explainparser.h"
 #include "queries/insertparser.h"
+#include "queries/prepareparser.h"
 #include "queries/select/selectparser.h"
 #include "queries/tableparser.h"
 #include "queries/updateparser.h"
@@ -30,18 +33,29 @@ auto Parser::parse_query(const std::string& query) -> void {
     const auto tableParser = TableParser(*this);
     const auto updateParser = UpdateParser(*this);
     const auto deleteParser = DeleteParser(*this);
+    const auto copyParser = CopyParser(*this);
+    const auto prepareParser = PrepareParser(*this);
+    const auto explainParser = ExplainParser(*this);
 
     if (query_elements.at(0) == "DATABASE") databaseParser.parse_database_query(query_elements);
-    else if (query_elements.at(0) == "SELECT") selectParser.parse_select_query(query_elements);
+    else if (query_elements.at(0) == "SELECT") selectParser.parse_select_query(query);
     else if (query_elements.at(0) == "INSERT") insertParser.parse_insert_query(query_elements);
     else if (query_elements.at(0) == "ALTER") alterParser.parse_alter_query(query_elements);
     else if (query_elements.at(0) == "TABLE") tableParser.parse_table_query(query_elements);
     else if (query_elements.at(0) == "UPDATE") updateParser.parse_update_query(query_elements);
     else if (query_elements.at(0) == "DELETE") deleteParser.parse_delete_query(query_elements);
+    else if (query_elements.at(0) == "COPY") copyParser.parse_copy_query(query_elements);
+    else if (query_elements.at(0) == "PREPARE") prepareParser.parse_prepare_query(query);
+    else if (query_elements.at(0) == "EXECUTE") prepareParser.parse_execute_query(query);
+    else if (query_elements.at(0) == "EXPLAIN") explainParser.parse_explain_query(query);
     else if (query_elements.at(0) == "SAVE") Serializer::save_databases_to_file();
     else fmt::println("Unknown command: {}", query_elements.at(0));
 }
 
+auto Parser::invalidate_prepared_plans() -> void {
+    for (auto& [name, prepared_statement] : prepared_statements) prepared_statement.plan.reset();
+}
+
 auto Parser::is_database_selected() const -> bool {
     if (database == nullptr) {
         fmt::println("No database selected. Please select it with 'DATABASE USE [...]'!");
@@ -1,9 +1,12 @@
 #pragma once
 
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include <optional>
 
+#include "queryplan.h"
+#include "queryprofiler.h"
 #include "../database/database.h"
 #include "../serializer/serializer.h"
 
@@ -11,6 +14,8 @@ class Parser {
 
 public:
     Database* database = nullptr;
+    std::unordered_map<std::string, PreparedStatement> prepared_statements;
+    std::optional<QueryProfiler> profiler;
 
     Parser() = default;
 
@@ -21,6 +26,7 @@ public:
     }
 
     auto parse_query(const std::string& query) -> void;
+    auto invalidate_prepared_plans() -> void;
     [[nodiscard]] auto is_database_selected() const -> bool;
 };
 
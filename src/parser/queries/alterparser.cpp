@@ -87,9 +87,12 @@ auto AlterParser::parse_alter_query(const std::vector<std::string> &query_elemen
             string_to_column_type(column_type),
             strings_to_constraints(constraints),
             column_foreign_key);
+
+        parser.invalidate_prepared_plans();
     } else if (query_elements.at(operation_clause_index) == "DROP") {
         const auto& column_to_remove_name = query_elements.at(column_clause_index + 1);
         parser.database->get_table_by_name(table_name).remove_column(column_to_remove_name);
+        parser.invalidate_prepared_plans();
     } else fmt::println("Query with ALTER clause should contain operation clause before COLUMN clause!");
 }
 
@@ -126,7 +129,7 @@ auto AlterParser::is_foreign_key_valid(
         return false;
     }
 
-    const auto foreign_table = parser.database->tables.at(foreign_table_name);
+    const auto& foreign_table = parser.database->tables.at(foreign_table_name);
     const auto column_found_in_foreign_table = std::ranges::find(foreign_table.column_names, foreign_column_name);
 
     if (column_found_in_foreign_table == foreign_table.column_names.end()) {
@@ -232,5 +235,13 @@ auto AlterParser::process_add_constraint(const std::vector<std::string> &query_e
     }
 
     table.column_constraints.at(column_index_in_table).push_back(string_to_constraint(constraint));
+
+    if (table.has_unique_constraint(column_index_in_table) &&
+        !table.unique_indexes.at(column_index_in_table) &&
+        !table.create_unique_index(column_index_in_table)) {
+        table.column_constraints.at(column_index_in_table).pop_back();
+        return;
+    }
+
     fmt::println("Successfully added constraint to column with name: '{}'", column_name);
 }
@@ -0,0 +1,161 @@
+#include "copyparser.h"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+
+auto CopyParser::parse_copy_query(const std::vector<std::string>& query_elements) const -> void {
+
+    if (!parser.is_database_selected()) return;
+
+    if (query_elements.size() < 4 || query_elements.at(2) != "FROM") {
+        fmt::println("Query with COPY clause should contain table name, FROM clause and file path!");
+        return;
+    }
+
+    const auto& table_name = query_elements.at(1);
+    const auto has_header = query_elements.back() == "HEADER";
+    auto file_path = std::string();
+
+    for (auto i = std::size_t{3}; i < query_elements.size() - (has_header ? 1 : 0); ++i) {
+        if (!file_path.empty()) file_path.append(" ");
+        file_path.append(query_elements.at(i));
+    }
+
+    if (file_path.size() < 2 || file_path.front() != '\'' || file_path.back() != '\'') {
+        fmt::println("File path in query with COPY clause should be enclosed in single quotes!");
+        return;
+    }
+
+    if (!parser.database->tables.contains(table_name)) {
+        fmt::println("Table with name '{}' does not exist in database with name: '{}'!", table_name, parser.database->name);
+        return;
+    }
+
+    copy_from_file(parser.database->get_table_by_name(table_name), file_path.substr(1, file_path.size() - 2), has_header);
+}
+
+auto CopyParser::copy_from_file(Table& table, const std::string& file_path, const bool has_header) -> void {
+    auto file = std::ifstream(file_path, std::ios::binary);
+
+    if (!file.is_open()) {
+        fmt::println("Failed to open file: {}", file_path);
+        return;
+    }
+
+    const auto start_time = std::chrono::steady_clock::now();
+
+    auto buffer = std::string();
+    auto fields = std::vector<std::string_view>{};
+    auto unescaped_fields = std::deque<std::string>{};
+    auto copied_rows = std::size_t{0};
+    auto line_number = std::size_t{0};
+    auto is_header_skipped = !has_header;
+
+    while (file) {
+        const auto leftover_size = buffer.size();
+        buffer.resize(leftover_size + chunk_size);
+        file.read(buffer.data() + leftover_size, chunk_size);
+        buffer.resize(leftover_size + file.gcount());
+
+        auto record_begin = std::size_t{0};
+        auto is_inside_quotes = false;
+
+        for (auto position = std::size_t{0}; position <= buffer.size(); ++position) {
+            const auto is_end_of_file = position == buffer.size() && !file;
+
+            if (position < buffer.size() && buffer[position] == '"') is_inside_quotes = !is_inside_quotes;
+            if (!is_end_of_file && (position == buffer.size() || buffer[position] != '\n' || is_inside_quotes)) continue;
+
+            const auto record = std::string_view(buffer).substr(record_begin, position - record_begin);
+            const auto fields_before = fields.size();
+            record_begin = position + 1;
+            ++line_number;
+
+            if (!is_header_skipped) {
+                is_header_skipped = true;
+                continue;
+            }
+
+            if (record.empty() || record == "\r") continue;
+
+            split_record(record, fields, unescaped_fields);
+
+            if (fields.size() - fields_before != table.column_names.size()) {
+                fmt::println("Line {} contains {} fields, but table '{}' has {} columns!", line_number, fields.size() - fields_before, table.name, table.column_names.size());
+                fmt::println("Copied {} rows into table '{}' before the error", copied_rows, table.name);
+                return;
+            }
+        }
+
+        if (!fields.empty()) {
+            const auto batch_rows = fields.size() / table.column_names.size();
+
+            if (table.insert_rows(fields) != batch_rows) {
+                fmt::println("Copied {} rows into table '{}' before the batch ending at line {} was rejected", copied_rows, table.name, line_number);
+                return;
+            }
+
+            copied_rows += batch_rows;
+        }
+
+        fields.clear();
+        unescaped_fields.clear();
+        buffer.erase(0, std::min(record_begin, buffer.size()));
+    }
+
+    const auto elapsed_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+    const auto rows_per_second = elapsed_seconds > 0 ? static_cast<double>(copied_rows) / elapsed_seconds : 0.0;
+
+    fmt::println("Successfully copied {} rows into table '{}' in {:.3f} s ({:.0f} rows/s)", copied_rows, table.name, elapsed_seconds, rows_per_second);
+}
+
+auto CopyParser::split_record(
+    std::string_view record,
+    std::vector<std::string_view>& fields,
+    std::deque<std::string>& unescaped_fields
+) -> void {
+    if (record.ends_with('\r')) record.remove_suffix(1);
+
+    auto position = std::size_t{0};
+
+    while (true) {
+        if (position < record.size() && record[position] == '"') {
+            const auto value_begin = ++position;
+            auto has_escaped_quotes = false;
+
+            while (position < record.size()) {
+                if (record[position] == '"') {
+                    if (position + 1 < record.size() && record[position + 1] == '"') {
+                        has_escaped_quotes = true;
+                        position += 2;
+                        continue;
+                    }
+                    break;
+                }
+                ++position;
+            }
+
+            auto value = record.substr(value_begin, position - value_begin);
+
+            if (has_escaped_quotes) {
+                auto& unescaped_value = unescaped_fields.emplace_back();
+                for (auto i = std::size_t{0}; i < value.size(); ++i) {
+                    unescaped_value.push_back(value[i]);
+                    if (value[i] == '"') ++i;
+                }
+                value = unescaped_value;
+            }
+
+            fields.push_back(value);
+            position = std::min(record.find(',', position), record.size());
+        } else {
+            const auto value_end = std::min(record.find(',', position), record.size());
+            fields.push_back(record.substr(position, value_end - position));
+            position = value_end;
+        }
+
+        if (position >= record.size()) return;
+        ++position;
+    }
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <deque>
+#include <string_view>
+
+#include "../parser.h"
+
+struct CopyParser {
+
+    Parser& parser;
+
+    explicit CopyParser(Parser& parser) : parser(parser) {}
+
+    auto parse_copy_query(const std::vector<std::string>& query_elements) const -> void;
+
+private:
+    static constexpr std::size_t chunk_size = 1 << 20;
+
+    static auto copy_from_file(Table& table, const std::string& file_path, bool has_header) -> void;
+    static auto split_record(
+        std::string_view record,
+        std::vector<std::string_view>& fields,
+        std::deque<std::string>& unescaped_fields
+    ) -> void;
+};
@@ -13,6 +13,7 @@ auto DatabaseParser::parse_database_query(const std::vector<std::string>& query_
     } else if (query_elements.at(1) == "USE") {
         const auto& database_name = query_elements.at(2);
         parser.database = Database::get_database(database_name);
+        parser.invalidate_prepared_plans();
 
         if (parser.database == nullptr) return;
 
@@ -20,5 +21,6 @@ auto DatabaseParser::parse_database_query(const std::vector<std::string>& query_
     } else if (query_elements.at(1) == "DROP") {
         const auto& database_name = query_elements.at(2);
         Database::drop_database(database_name);
+        parser.invalidate_prepared_plans();
     } else fmt::println("Query with DATABASE clause should contain correct operation clause after DATABASE clause!");
 }
\ No newline at end of file
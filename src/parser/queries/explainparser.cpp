@@ -0,0 +1,45 @@
+#include "explainparser.h"
+
+auto ExplainParser::parse_explain_query(const std::string& query) const -> void {
+
+    if (!parser.is_database_selected()) return;
+
+    if (parser.profiler) {
+        fmt::println("EXPLAIN queries cannot be nested!");
+        return;
+    }
+
+    auto statement = strip_first_word(query);
+    const auto is_analyze = get_first_word(statement) == "ANALYZE";
+    if (is_analyze) statement = strip_first_word(statement);
+
+    const auto statement_type = get_first_word(statement);
+
+    if (statement_type != "SELECT" && statement_type != "UPDATE" && statement_type != "DELETE" && statement_type != "EXECUTE") {
+        fmt::println("Only SELECT, UPDATE, DELETE and EXECUTE queries can be explained!");
+        return;
+    }
+
+    parser.profiler.emplace(is_analyze);
+
+    const auto start = QueryProfiler::checkpoint();
+    parser.parse_query(statement);
+    parser.profiler->print(start);
+
+    parser.profiler.reset();
+}
+
+auto ExplainParser::get_first_word(const std::string& query) -> std::string {
+    const auto begin = query.find_first_not_of(whitespace);
+    if (begin == std::string::npos) return {};
+
+    return query.substr(begin, query.find_first_of(whitespace, begin) - begin);
+}
+
+auto ExplainParser::strip_first_word(const std::string& query) -> std::string {
+    const auto word_begin = query.find_first_not_of(whitespace);
+    if (word_begin == std::string::npos) return {};
+
+    const auto begin = query.find_first_not_of(whitespace, query.find_first_of(whitespace, word_begin));
+    return begin == std::string::npos ? std::string() : query.substr(begin);
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <string>
+
+#include "../parser.h"
+
+struct ExplainParser {
+
+    Parser& parser;
+
+    explicit ExplainParser(Parser& parser) : parser(parser) {}
+
+    auto parse_explain_query(const std::string& query) const -> void;
+
+private:
+    static constexpr auto whitespace = " \t\r\n";
+
+    static auto get_first_word(const std::string& query) -> std::string;
+
+    static auto strip_first_word(const std::string& query) -> std::string;
+};
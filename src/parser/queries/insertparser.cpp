@@ -17,6 +17,13 @@ auto InsertParser::parse_insert_query(const std::vector<std::string>& query_elem
     }
 
     const auto& table_name = query_elements.at(2);
+
+    if (values_clause_index + 1 < query_elements.size() && query_elements.at(values_clause_index + 1).starts_with('(')) {
+        const auto rows = split_tuples(std::vector(query_elements.begin() + values_clause_index + 1, query_elements.end()));
+        if (!rows.empty()) parser.database->insert_data(table_name, rows);
+        return;
+    }
+
     auto values = std::vector(query_elements.begin() + values_clause_index + 1, query_elements.end());
     auto cleaned_values = std::vector<std::string>{};
 
@@ -49,6 +56,59 @@ auto InsertParser::parse_insert_query(const std::vector<std::string>& query_elem
     parser.database->insert_data(table_name, cleaned_values);
 }
 
+auto InsertParser::split_tuples(const std::vector<std::string>& values) -> std::vector<std::vector<std::string>> {
+    auto values_text = std::string();
+    for (const auto& value : values) values_text.append(value + " ");
+
+    auto rows = std::vector<std::vector<std::string>>{};
+    auto current_value = std::string();
+    auto is_inside_tuple = false;
+    auto is_inside_quotes = false;
+    auto is_value_started = false;
+
+    const auto finish_value = [&] {
+        if (is_value_started) rows.back().push_back(current_value);
+        current_value.clear();
+        is_value_started = false;
+    };
+
+    for (const auto character : values_text) {
+        if (is_inside_quotes) {
+            if (character == '\'') is_inside_quotes = false;
+            else current_value.push_back(character);
+            continue;
+        }
+
+        if (character == '(' && !is_inside_tuple) {
+            rows.emplace_back();
+            is_inside_tuple = true;
+        } else if (character == ')' && is_inside_tuple) {
+            finish_value();
+            is_inside_tuple = false;
+        } else if (!is_inside_tuple) {
+            if (character != ',' && character != ' ') {
+                fmt::println("Values in query with INSERT clause should be enclosed in parentheses and separated by commas!");
+                return {};
+            }
+        } else if (character == ',' || character == ' ') {
+            finish_value();
+        } else if (character == '\'') {
+            is_inside_quotes = true;
+            is_value_started = true;
+        } else {
+            current_value.push_back(character);
+            is_value_started = true;
+        }
+    }
+
+    if (is_inside_tuple || is_inside_quotes) {
+        fmt::println("Values in query with INSERT clause contain unclosed parenthesis or quote!");
+        return {};
+    }
+
+    return rows;
+}
+
 auto InsertParser::find_index(const std::vector<std::string> &vec, const std::string &value) -> int {
     for (int i = 0; i < vec.size(); ++i) {
         if (vec[i] == value) return i;
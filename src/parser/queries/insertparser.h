@@ -12,4 +12,5 @@ struct InsertParser {
 
 private:
     static auto find_index(const std::vector<std::string>& vec, const std::string& value) -> int;
+    static auto split_tuples(const std::vector<std::string>& values) -> std::vector<std::vector<std::string>>;
 };
\ No newline at end of file
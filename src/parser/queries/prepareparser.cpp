@@ -0,0 +1,128 @@
+#include "prepareparser.h"
+
+#include "select/selectparser.h"
+#include "../astparser.h"
+
+auto PrepareParser::parse_prepare_query(const std::string& query) const -> void {
+
+    if (!parser.is_database_selected()) return;
+
+    auto tokens = Lexer(query).tokenize();
+    if (!tokens) return;
+
+    if (tokens->size() < 4 || tokens->at(1).type != TokenType::WORD || !tokens->at(2).is("AS")) {
+        fmt::println("Query with PREPARE clause should contain statement name and AS clause!");
+        return;
+    }
+
+    if (!tokens->at(3).is("SELECT")) {
+        fmt::println("Only queries with SELECT clause can be prepared!");
+        return;
+    }
+
+    const auto name = std::string(tokens->at(1).text);
+    tokens->erase(tokens->begin(), tokens->begin() + 3);
+
+    auto statement = AstParser(std::move(*tokens)).parse_select();
+    if (!statement) return;
+
+    auto prepared_statement = PreparedStatement{std::move(*statement), {}, std::nullopt};
+    prepared_statement.parameter_indices = get_parameter_indices(prepared_statement.statement);
+    prepared_statement.plan = SelectParser(parser).plan_select(prepared_statement.statement);
+    if (!prepared_statement.plan) return;
+
+    parser.prepared_statements.insert_or_assign(name, std::move(prepared_statement));
+    fmt::println("Successfully prepared statement with name: '{}'", name);
+}
+
+auto PrepareParser::parse_execute_query(const std::string& query) const -> void {
+
+    if (!parser.is_database_selected()) return;
+
+    const auto tokens = Lexer(query).tokenize();
+    if (!tokens) return;
+
+    if (tokens->size() < 3 || tokens->at(1).type != TokenType::WORD) {
+        fmt::println("Query with EXECUTE clause should contain prepared statement name!");
+        return;
+    }
+
+    const auto name = std::string(tokens->at(1).text);
+    const auto it = parser.prepared_statements.find(name);
+
+    if (it == parser.prepared_statements.end()) {
+        fmt::println("Prepared statement with name '{}' doesn't exist!", name);
+        return;
+    }
+
+    const auto values = parse_parameter_values(*tokens);
+    if (!values) return;
+
+    auto& [statement, parameter_indices, plan] = it->second;
+
+    if (values->size() != parameter_indices.size()) {
+        fmt::println("Prepared statement '{}' expects {} parameters, but got {}!", name, parameter_indices.size(), values->size());
+        return;
+    }
+
+    const auto select_parser = SelectParser(parser);
+
+    if (!plan) {
+        plan = select_parser.plan_select(statement);
+        if (!plan) return;
+    }
+
+    for (auto i = std::size_t{0}; i < parameter_indices.size(); ++i) {
+        statement.where->expressions[parameter_indices[i]].condition.value = values->at(i);
+    }
+
+    select_parser.print_select(statement, *plan);
+}
+
+auto PrepareParser::get_parameter_indices(const SelectStatement& statement) -> std::vector<std::size_t> {
+    auto parameter_indices = std::vector<std::size_t>{};
+    if (!statement.where) return parameter_indices;
+
+    for (auto i = std::size_t{0}; i < statement.where->expressions.size(); ++i) {
+        const auto& expression = statement.where->expressions[i];
+        if (expression.type == ExpressionType::CONDITION && expression.condition.is_parameter) parameter_indices.push_back(i);
+    }
+
+    return parameter_indices;
+}
+
+auto PrepareParser::parse_parameter_values(const std::vector<Token>& tokens) -> std::optional<std::vector<std::string>> {
+    auto values = std::vector<std::string>{};
+    if (tokens.at(2).type == TokenType::END) return values;
+
+    if (tokens.at(2).type != TokenType::LEFT_PARENTHESIS) {
+        fmt::println("Parameter values after EXECUTE clause should be enclosed in parentheses!");
+        return std::nullopt;
+    }
+
+    auto position = std::size_t{3};
+
+    while (tokens.at(position).type != TokenType::RIGHT_PARENTHESIS) {
+        const auto& value_token = tokens.at(position++);
+
+        if (value_token.type != TokenType::WORD && value_token.type != TokenType::STRING) {
+            fmt::println("Expected parameter value, but got '{}'!", value_token.text);
+            return std::nullopt;
+        }
+
+        values.emplace_back(value_token.text);
+
+        if (tokens.at(position).type == TokenType::COMMA) ++position;
+        else if (tokens.at(position).type != TokenType::RIGHT_PARENTHESIS) {
+            fmt::println("Expected ',' or ')' after parameter value, but got '{}'!", tokens.at(position).text);
+            return std::nullopt;
+        }
+    }
+
+    if (tokens.at(position + 1).type != TokenType::END) {
+        fmt::println("Unexpected token '{}' after parameter values!", tokens.at(position + 1).text);
+        return std::nullopt;
+    }
+
+    return values;
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "../lexer.h"
+#include "../parser.h"
+
+struct PrepareParser {
+
+    Parser& parser;
+
+    explicit PrepareParser(Parser& parser) : parser(parser) {}
+
+    auto parse_prepare_query(const std::string& query) const -> void;
+
+    auto parse_execute_query(const std::string& query) const -> void;
+
+private:
+    static auto get_parameter_indices(const SelectStatement& statement) -> std::vector<std::size_t>;
+
+    static auto parse_parameter_values(const std::vector<Token>& tokens) -> std::optional<std::vector<std::string>>;
+};
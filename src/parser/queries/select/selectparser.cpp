@@ -1,916 +1,1465 @@
 #include "selectparser.h"
 
-#include <set>
+#include <bit>
+#include <limits>
+#include <numeric>
+#include <unordered_set>
 
 #include "whereclauseparser.h"
+#include "../../astparser.h"
 
-auto SelectParser::parse_select_query(const std::vector<std::string>& query_elements) const -> void {
+auto SelectParser::parse_select_query(const std::string& query) const -> void {
 
     if (!parser.is_database_selected()) return;
 
-    const auto from_clause_index = find_index(query_elements, "FROM");
-    const auto inner_clause_index = find_index(query_elements, "INNER");
-    const auto left_clause_index = find_index(query_elements, "LEFT");
-    const auto right_clause_index = find_index(query_elements, "RIGHT");
-    const auto full_clause_index = find_index(query_elements, "FULL");
+    auto tokens = Lexer(query).tokenize();
+    if (!tokens) return;
 
-    if (from_clause_index == -1) {
-        fmt::println("Query with SELECT clause should contain FROM clause!");
-        return;
-    }
-
-    const auto column_names = std::vector(query_elements.begin() + 1, query_elements.begin() + from_clause_index);
+    const auto statement = AstParser(std::move(*tokens)).parse_select();
+    if (!statement) return;
 
-    if (inner_clause_index != -1 || left_clause_index != -1 || right_clause_index != -1 || full_clause_index != -1) {
-        print_appropriate_columns_with_joins(query_elements, column_names);
-        return;
-    }
+    const auto plan = plan_select(*statement);
+    if (!plan) return;
 
-    print_appropriate_columns_without_joins(query_elements);
+    print_select(*statement, *plan);
 }
 
-auto SelectParser::get_select_inner_join_result(
-    const std::vector<std::string> &query_elements,
-    const std::vector<std::string> &column_names
-) const -> std::vector<std::vector<std::string>> {
+auto SelectParser::plan_select(const SelectStatement& statement) const -> std::optional<SelectPlan> {
+    const auto database = parser.database;
+    auto plan = SelectPlan{};
 
-    const auto from_clause_index = find_index(query_elements, "FROM");
-    const auto inner_clause_index = find_index(query_elements, "INNER");
-    const auto join_clause_index = find_index(query_elements, "JOIN");
-    const auto on_clause_index = find_index(query_elements, "ON");
+    if (statement.joins.empty()) {
+        for (const auto& table_name : statement.table_names) {
+            if (!database->tables.contains(table_name)) {
+                fmt::println("Table with name '{}' doesn't exist in database '{}'!", table_name, database->name);
+                return std::nullopt;
+            }
 
-    if (!is_valid_select_join_query(inner_clause_index, join_clause_index, on_clause_index)) {
-        fmt::println("Query with SELECT and INNER clause should contain JOIN and ON clauses!");
-        return {};
-    }
+            plan.tables.push_back(&database->tables.find(table_name)->second);
+        }
 
-    auto table_names = std::vector(query_elements.begin() + from_clause_index + 1, query_elements.begin() +  inner_clause_index);
-    table_names.emplace_back(query_elements.at(join_clause_index + 1));
+        if (!statement.order_by.empty() && plan.tables.size() != 1) {
+            fmt::println("Query with ORDER BY clause should contain exactly one table name after FROM clause!");
+            return std::nullopt;
+        }
 
-    const auto& left = query_elements.at(on_clause_index + 1);
-    const auto& right = query_elements.at(on_clause_index + 3);
+        if (statement.is_aggregate() && plan.tables.size() != 1) {
+            fmt::println("Query with aggregation should contain exactly one table name after FROM clause!");
+            return std::nullopt;
+        }
 
-    if (!validate_tables_and_columns(left, right, query_elements)) return {};
+        if (statement.is_distinct && plan.tables.size() != 1) {
+            fmt::println("Query with DISTINCT clause should contain exactly one table name after FROM clause!");
+            return std::nullopt;
+        }
+    } else {
+        auto tables = get_joined_tables(statement);
+        if (!tables) return std::nullopt;
 
-    if (column_names.size() == 1 and column_names.at(0) == "*") {
-        return get_all_columns_for_join(left, right, JoinType::INNER);
+        plan.tables = std::move(*tables);
     }
 
-    return get_specific_columns_for_inner_join(left, right, column_names);
-}
-
-auto SelectParser::get_specific_columns_for_inner_join(
-    const std::string &left,
-    const std::string &right,
-    const std::vector<std::string> &column_names
-) const -> std::vector<std::vector<std::string>> {
-    auto data = std::vector<std::vector<std::string>>{};
+    if (statement.is_aggregate()) {
+        if (!plan_aggregation(statement, plan)) return std::nullopt;
+    } else if (statement.joins.empty()) {
+        for (const auto* table : plan.tables) plan.column_indices.push_back(resolve_projection(statement, *table));
+    } else {
+        if (statement.is_select_all) {
+            for (auto table_index = std::size_t{0}; table_index < plan.tables.size(); ++table_index) {
+                for (int i = 0; i < plan.tables[table_index]->column_names.size(); i++) plan.joined_columns.push_back({table_index, i});
+            }
+        }
 
-    const auto [left_table_name, left_column_name] = split_string_with_dot(left);
-    const auto [right_table_name, right_column_name] = split_string_with_dot(right);
+        for (const auto& [column, aggregate] : statement.columns) {
+            const auto joined_column = resolve_joined_column(column, plan.tables);
+            if (!joined_column) return std::nullopt;
 
-    auto left_table = parser.database->tables.find(left_table_name)->second;
-    auto right_table = parser.database->tables.find(right_table_name)->second;
+            plan.joined_columns.push_back(*joined_column);
+        }
+    }
 
-    const auto left_column_id = Table::find_index(left_table.column_names, left_column_name);
-    const auto right_column_id = Table::find_index(right_table.column_names, right_column_name);
+    auto order_keys = resolve_order_keys(statement, plan.tables);
+    if (!order_keys) return std::nullopt;
 
-    for (const auto& left_table_data : left_table.get_all_data()) {
-        for (const auto& right_table_data : right_table.get_all_data()) {
-            if (left_table_data[left_column_id] == right_table_data[right_column_id]) {
-                auto combined_data = std::vector<std::string>{};
-                for (auto column_name : column_names) {
-                    std::erase(column_name, ',');
-                    if (const auto dot_pos = column_name.find('.'); dot_pos != std::string::npos) {
-                        const auto [t_name, c_name] = split_string_with_dot(column_name);
-                        if (t_name == left_table_name) combined_data.push_back(left_table_data[Table::find_index(left_table.column_names, c_name)]);
-                        else if (t_name == right_table_name) combined_data.push_back(right_table_data[Table::find_index(right_table.column_names, c_name)]);
-                    } else {
-                        const auto c_left_index = Table::find_index(left_table.column_names, column_name);
-                        const auto c_right_index = Table::find_index(right_table.column_names, column_name);
+    plan.order_keys = std::move(*order_keys);
 
-                        if (c_left_index != -1 && c_right_index != -1) {
-                            fmt::println("Column with name '{}' exists in both tables!", column_name);
-                            return {};
-                        }
+    if (statement.is_aggregate()) {
+        for (const auto& [column, is_descending] : plan.order_keys) {
+            if (std::ranges::find(plan.group_columns, column) == plan.group_columns.end()) {
+                fmt::println("Column after ORDER BY clause in query with aggregation should be listed after GROUP BY clause!");
+                return std::nullopt;
+            }
+        }
+    }
 
-                        if (c_left_index != -1) combined_data.push_back(left_table_data[Table::find_index(left_table.column_names, column_name)]);
-                        if (c_right_index != -1) combined_data.push_back(right_table_data[Table::find_index(right_table.column_names, column_name)]);
-                    }
-                }
-                data.push_back(combined_data);
+    if (statement.is_distinct) {
+        for (const auto& [column, is_descending] : plan.order_keys) {
+            if (!is_projected(plan, column)) {
+                fmt::println("Column after ORDER BY clause in query with DISTINCT clause should be listed after SELECT clause!");
+                return std::nullopt;
             }
         }
     }
 
-    return data;
+    return plan;
 }
 
-auto SelectParser::get_select_left_join_result(
-    const std::vector<std::string> &query_elements,
-    const std::vector<std::string> &column_names
-) const -> std::vector<std::vector<std::string>> {
-    const auto from_clause_index = find_index(query_elements, "FROM");
-    const auto left_clause_index = find_index(query_elements, "LEFT");
-    const auto join_clause_index = find_index(query_elements, "JOIN");
-    const auto on_clause_index = find_index(query_elements, "ON");
+auto SelectParser::is_projected(const SelectPlan& plan, const JoinedColumn& column) -> bool {
+    if (!plan.selected_aggregates.empty()) {
+        return std::ranges::any_of(plan.selected_aggregates, [&](const SelectedAggregate& selected_aggregate) {
+            return selected_aggregate.function == AggregateFunction::NONE && selected_aggregate.column == column;
+        });
+    }
 
-    if (!is_valid_select_join_query(left_clause_index, join_clause_index, on_clause_index)) {
-        fmt::println("Query with SELECT and LEFT clause should contain JOIN and ON clauses!");
-        return {};
+    if (!plan.column_indices.empty()) {
+        const auto& column_indices = plan.column_indices[column.table_index];
+        return std::ranges::find(column_indices, column.column_index) != column_indices.end();
     }
 
-    auto table_names = std::vector(query_elements.begin() + from_clause_index + 1, query_elements.begin() +  left_clause_index);
-    table_names.emplace_back(query_elements.at(join_clause_index + 1));
+    return std::ranges::find(plan.joined_columns, column) != plan.joined_columns.end();
+}
 
-    const auto& left = query_elements.at(on_clause_index + 1);
-    const auto& right = query_elements.at(on_clause_index + 3);
+auto SelectParser::plan_aggregation(const SelectStatement& statement, SelectPlan& plan) -> bool {
+    if (statement.is_select_all) {
+        fmt::println("Query with aggregation can't select all columns with '*'!");
+        return false;
+    }
 
-    if (!validate_tables_and_columns(left, right, query_elements)) return {};
+    for (const auto& column : statement.group_by) {
+        const auto joined_column = resolve_joined_column(column, plan.tables);
+        if (!joined_column) return false;
 
-    if (column_names.size() == 1 and column_names.at(0) == "*") {
-        return get_all_columns_for_join(left, right, JoinType::LEFT);
+        plan.group_columns.push_back(*joined_column);
     }
 
-    return get_specific_columns_for_left_join(left, right, column_names);
+    for (const auto& [column, aggregate] : statement.columns) {
+        if (aggregate == AggregateFunction::COUNT && column.table_name.empty() && column.column_name == "*") {
+            plan.selected_aggregates.push_back({aggregate, std::nullopt});
+            continue;
+        }
+
+        const auto joined_column = resolve_joined_column(column, plan.tables);
+        if (!joined_column) return false;
+
+        const auto column_type = plan.tables[joined_column->table_index]->columns[joined_column->column_index].type;
+        const auto is_numeric = column_type == ColumnType::INTEGER || column_type == ColumnType::FLOAT;
+
+        if ((aggregate == AggregateFunction::SUM || aggregate == AggregateFunction::AVG) && !is_numeric) {
+            fmt::println("Function {} accepts only INTEGER or FLOAT columns!", aggregate_function_to_string(aggregate));
+            return false;
+        }
+
+        if (aggregate == AggregateFunction::NONE && std::ranges::find(plan.group_columns, *joined_column) == plan.group_columns.end()) {
+            fmt::println("Column '{}' should be listed after GROUP BY clause or used in aggregate function!", column.column_name);
+            return false;
+        }
+
+        plan.selected_aggregates.push_back({aggregate, *joined_column});
+    }
+
+    return true;
 }
 
-auto SelectParser::get_specific_columns_for_left_join(
-    const std::string &left, const std::string &right, const std::vector<std::string> &column_names
-) const -> std::vector<std::vector<std::string>> {
+auto SelectParser::print_select(const SelectStatement& statement, const SelectPlan& plan) const -> void {
+    if (statement.is_aggregate()) print_select_with_aggregation(statement, plan);
+    else if (!statement.joins.empty()) print_select_with_join(statement, plan);
+    else print_select_without_join(statement, plan);
+}
+
+auto SelectParser::print_select_without_join(const SelectStatement& statement, const SelectPlan& plan) const -> void {
+    const auto where_clause_parser = WhereClauseParser(parser);
+    auto flattened_results = std::vector<std::vector<std::string>>{};
+    auto rows_to_skip = statement.offset;
+    auto rows_to_take = statement.limit.value_or(std::numeric_limits<std::size_t>::max());
+
+    for (auto table_index = std::size_t{0}; table_index < plan.tables.size() && rows_to_take > 0; ++table_index) {
+        const auto& table = *plan.tables[table_index];
+        const auto& column_indices = plan.column_indices[table_index];
 
-    auto data = std::vector<std::vector<std::string>>{};
+        const auto row_bound = rows_to_skip + std::min(rows_to_take, std::numeric_limits<std::size_t>::max() - rows_to_skip);
+        auto positions = std::vector<std::size_t>{};
 
-    const auto [left_table_name, left_column_name] = split_string_with_dot(left);
-    const auto [right_table_name, right_column_name] = split_string_with_dot(right);
+        const auto is_ordered = !plan.order_keys.empty();
+        const auto is_full_scan = is_ordered || statement.is_distinct;
 
-    auto left_table = parser.database->tables.find(left_table_name)->second;
-    auto right_table = parser.database->tables.find(right_table_name)->second;
+        if (!statement.where) {
+            const auto start = QueryProfiler::checkpoint();
+            positions.resize(is_full_scan ? table.row_count() : std::min(row_bound, table.row_count()));
+            std::iota(positions.begin(), positions.end(), std::size_t{0});
 
-    const auto left_column_id = Table::find_index(left_table.column_names, left_column_name);
-    const auto right_column_id = Table::find_index(right_table.column_names, right_column_name);
+            if (parser.profiler) parser.profiler->record(fmt::format("Scan '{}'", table.name), table.row_count(), positions.size(), positions.capacity() * sizeof(std::size_t), start);
+        } else if (statement.limit && !is_full_scan) {
+            positions = where_clause_parser.get_first_positions_filtered_by(table, *statement.where, row_bound);
+        } else positions = where_clause_parser.get_positions_filtered_by(table, *statement.where);
 
-    for (const auto& left_table_data : left_table.get_all_data()) {
+        if (is_plan_only()) {
+            record_planned_stages(statement, plan, positions.size(), column_indices.size());
+            continue;
+        }
 
-        auto match_found = false;
+        if (statement.is_distinct) {
+            const auto start = QueryProfiler::checkpoint();
+            const auto rows_in = positions.size();
+            const auto max_rows = is_ordered ? std::numeric_limits<std::size_t>::max() : row_bound;
+            filter_distinct_positions(positions, table, column_indices, max_rows);
 
-        for (const auto& right_table_data : right_table.get_all_data()) {
-            if (left_table_data[left_column_id] == right_table_data[right_column_id]) {
-                auto combined_data = std::vector<std::string>{};
-                for (auto column_name : column_names) {
-                    std::erase(column_name, ',');
-                    if (const auto dot_pos = column_name.find('.'); dot_pos != std::string::npos) {
-                        const auto [t_name, c_name] = split_string_with_dot(column_name);
-                        if (t_name == left_table_name) combined_data.push_back(left_table_data[Table::find_index(left_table.column_names, c_name)]);
-                        else if (t_name == right_table_name) combined_data.push_back(right_table_data[Table::find_index(right_table.column_names, c_name)]);
-                    } else {
-                        const auto c_left_index = Table::find_index(left_table.column_names, column_name);
-                        const auto c_right_index = Table::find_index(right_table.column_names, column_name);
-
-                        if (c_left_index != -1 && c_right_index != -1) {
-                            fmt::println("Column with name '{}' exists in both tables!", column_name);
-                            return {};
-                        }
-
-                        if (c_left_index != -1) combined_data.push_back(left_table_data[Table::find_index(left_table.column_names, column_name)]);
-                        if (c_right_index != -1) combined_data.push_back(right_table_data[Table::find_index(right_table.column_names, column_name)]);
-                    }
-                }
-                data.push_back(combined_data);
-                match_found = true;
-            }
+            if (parser.profiler) parser.profiler->record("Hash distinct", rows_in, positions.size(), DistinctFilter::get_table_bytes(rows_in, max_rows), start);
         }
 
-        if (!match_found) {
-            auto combined_data = std::vector<std::string>{};
-            for (auto column_name : column_names) {
-                std::erase(column_name, ',');
-                if (const auto dot_pos = column_name.find('.'); dot_pos != std::string::npos) {
-                    const auto [t_name, c_name] = split_string_with_dot(column_name);
-                    if (t_name == left_table_name) combined_data.push_back(left_table_data[Table::find_index(left_table.column_names, c_name)]);
-                    else combined_data.emplace_back("");
-                } else {
-                    const auto c_left_index = Table::find_index(left_table.column_names, column_name);
-                    const auto c_right_index = Table::find_index(right_table.column_names, column_name);
-
-                    if (c_left_index != -1 && c_right_index != -1) {
-                        fmt::println("Column with name '{}' exists in both tables!", column_name);
-                        return {};
-                    }
-
-                    if (c_left_index != -1) combined_data.push_back(left_table_data[Table::find_index(left_table.column_names, column_name)]);
-                    else combined_data.emplace_back("");
-                }
+        if (is_ordered) {
+            const auto start = QueryProfiler::checkpoint();
+            const auto rows_in = positions.size();
+            get_row_sorter(plan).sort(positions, row_bound);
+
+            if (parser.profiler) {
+                parser.profiler->record(
+                    describe_sort(statement, plan, rows_in),
+                    rows_in, positions.size(), RowSorter::get_buffer_bytes(rows_in, row_bound), start);
             }
-            data.push_back(combined_data);
         }
-    }
 
-    return data;
-}
+        const auto start = QueryProfiler::checkpoint();
+        const auto rows_in = positions.size();
+        const auto skipped_rows = std::min(rows_to_skip, positions.size());
+        positions.erase(positions.begin(), positions.begin() + static_cast<std::ptrdiff_t>(skipped_rows));
+        if (positions.size() > rows_to_take) positions.resize(rows_to_take);
+
+        rows_to_skip -= skipped_rows;
+        rows_to_take -= positions.size();
+
+        auto data_from_table = table.get_data_from(column_indices, positions);
 
-auto SelectParser::get_select_right_join_result(
-    const std::vector<std::string> &query_elements,
-    const std::vector<std::string> &column_names
-) const -> std::vector<std::vector<std::string>> {
-    const auto from_clause_index = find_index(query_elements, "FROM");
-    const auto right_clause_index = find_index(query_elements, "RIGHT");
-    const auto join_clause_index = find_index(query_elements, "JOIN");
-    const auto on_clause_index = find_index(query_elements, "ON");
+        if (parser.profiler) {
+            parser.profiler->record(
+                describe_output(statement, column_indices.size()),
+                rows_in, positions.size(), get_rows_bytes(data_from_table), start);
+        }
 
-    if (!is_valid_select_join_query(right_clause_index, join_clause_index, on_clause_index)) {
-        fmt::println("Query with SELECT and RIGHT clause should contain JOIN and ON clauses!");
-        return {};
+        flattened_results.insert(
+            flattened_results.end(),
+            std::make_move_iterator(data_from_table.begin()),
+            std::make_move_iterator(data_from_table.end()));
     }
 
-    auto table_names = std::vector(query_elements.begin() + from_clause_index + 1, query_elements.begin() +  right_clause_index);
-    table_names.emplace_back(query_elements.at(join_clause_index + 1));
+    print_rows(flattened_results);
+}
 
-    const auto& left = query_elements.at(on_clause_index + 1);
-    const auto& right = query_elements.at(on_clause_index + 3);
+auto SelectParser::resolve_projection(const SelectStatement& statement, const Table& table) -> std::vector<int> {
+    auto column_indices = std::vector<int>{};
 
-    if (!validate_tables_and_columns(left, right, query_elements)) return {};
+    if (statement.is_select_all) {
+        column_indices.resize(table.column_names.size());
+        std::iota(column_indices.begin(), column_indices.end(), 0);
+        return column_indices;
+    }
 
-    if (column_names.size() == 1 and column_names.at(0) == "*") {
-        return get_all_columns_for_join(left, right, JoinType::RIGHT);
+    column_indices.reserve(statement.columns.size());
+
+    for (const auto& [column, aggregate] : statement.columns) {
+        const auto is_other_table = !column.table_name.empty() && column.table_name != table.name;
+        column_indices.push_back(is_other_table ? -1 : Table::find_index(table.column_names, column.column_name));
     }
 
-    return get_specific_columns_for_right_join(left, right, column_names);
+    return column_indices;
 }
 
-auto SelectParser::get_specific_columns_for_right_join(
-    const std::string &left,
-    const std::string &right,
-    const std::vector<std::string> &column_names
-) const -> std::vector<std::vector<std::string>> {
+auto SelectParser::print_select_with_join(const SelectStatement& statement, const SelectPlan& plan) const -> void {
+    const auto& tables = plan.tables;
+    const auto row_bound = statement.get_row_bound();
+    const auto is_ordered = !plan.order_keys.empty();
 
-    auto data = std::vector<std::vector<std::string>>{};
+    const auto unordered_row_bound = is_ordered ? std::numeric_limits<std::size_t>::max() : row_bound;
 
-    const auto [left_table_name, left_column_name] = split_string_with_dot(left);
-    const auto [right_table_name, right_column_name] = split_string_with_dot(right);
+    const auto joined_rows = get_filtered_joined_rows(statement, plan, statement.is_distinct ? std::numeric_limits<std::size_t>::max() : unordered_row_bound);
+    if (!joined_rows) return;
 
-    auto left_table = parser.database->tables.find(left_table_name)->second;
-    auto right_table = parser.database->tables.find(right_table_name)->second;
+    if (is_plan_only()) {
+        record_planned_stages(statement, plan, std::numeric_limits<std::size_t>::max(), plan.joined_columns.size());
+        return;
+    }
 
-    const auto left_column_id = Table::find_index(left_table.column_names, left_column_name);
-    const auto right_column_id = Table::find_index(right_table.column_names, right_column_name);
+    auto row_order = std::vector<std::size_t>(joined_rows->size());
+    std::iota(row_order.begin(), row_order.end(), std::size_t{0});
 
-    for (const auto& right_table_data : right_table.get_all_data()) {
+    if (statement.is_distinct) {
+        const auto start = QueryProfiler::checkpoint();
+        filter_distinct_rows(row_order, *joined_rows, plan.joined_columns, tables, unordered_row_bound);
 
-        auto match_found = false;
+        if (parser.profiler) {
+            parser.profiler->record(
+                "Hash distinct",
+                joined_rows->size(), row_order.size(), DistinctFilter::get_table_bytes(joined_rows->size(), unordered_row_bound), start);
+        }
+    }
 
-        for (const auto& left_table_data : left_table.get_all_data()) {
-            if (right_table_data[right_column_id] == left_table_data[left_column_id]) {
-                auto combined_data = std::vector<std::string>{};
-                for (auto column_name : column_names) {
-                    std::erase(column_name, ',');
-                    if (const auto dot_pos = column_name.find('.'); dot_pos != std::string::npos) {
-                        const auto [t_name, c_name] = split_string_with_dot(column_name);
-                        if (t_name == left_table_name) combined_data.push_back(left_table_data[Table::find_index(left_table.column_names, c_name)]);
-                        else if (t_name == right_table_name) combined_data.push_back(right_table_data[Table::find_index(right_table.column_names, c_name)]);
-                    } else {
-                        const auto c_left_index = Table::find_index(left_table.column_names, column_name);
-                        const auto c_right_index = Table::find_index(right_table.column_names, column_name);
-
-                        if (c_left_index != -1 && c_right_index != -1) {
-                            fmt::println("Column with name '{}' exists in both tables!", column_name);
-                            return {};
-                        }
-
-                        if (c_left_index != -1) combined_data.push_back(left_table_data[Table::find_index(left_table.column_names, column_name)]);
-                        if (c_right_index != -1) combined_data.push_back(right_table_data[Table::find_index(right_table.column_names, column_name)]);
-                    }
-                }
-                data.push_back(combined_data);
-                match_found = true;
-            }
+    if (is_ordered) {
+        const auto start = QueryProfiler::checkpoint();
+        const auto rows_in = row_order.size();
+        get_row_sorter(plan).sort(row_order, *joined_rows, row_bound);
+
+        if (parser.profiler) {
+            parser.profiler->record(
+                describe_sort(statement, plan, rows_in),
+                rows_in, row_order.size(), RowSorter::get_buffer_bytes(rows_in, row_bound), start);
         }
+    }
 
-        if (!match_found) {
-            auto combined_data = std::vector<std::string>{};
-            for (auto column_name : column_names) {
-                std::erase(column_name, ',');
-                if (const auto dot_pos = column_name.find('.'); dot_pos != std::string::npos) {
-                    const auto [t_name, c_name] = split_string_with_dot(column_name);
-                    if (t_name == right_table_name) combined_data.push_back(right_table_data[Table::find_index(right_table.column_names, c_name)]);
-                    else combined_data.emplace_back("");
-                } else {
-                    const auto c_left_index = Table::find_index(left_table.column_names, column_name);
-                    const auto c_right_index = Table::find_index(right_table.column_names, column_name);
-
-                    if (c_left_index != -1 && c_right_index != -1) {
-                        fmt::println("Column with name '{}' exists in both tables!", column_name);
-                        return {};
-                    }
-
-                    if (c_right_index != -1) combined_data.push_back(right_table_data[Table::find_index(right_table.column_names, column_name)]);
-                    else combined_data.emplace_back("");
-                }
-            }
-            data.push_back(combined_data);
+    const auto start = QueryProfiler::checkpoint();
+    const auto first_row = std::min(statement.offset, row_order.size());
+    const auto last_row = std::min(row_bound, row_order.size());
+
+    auto results = std::vector<std::vector<std::string>>{};
+    results.reserve(last_row - first_row);
+
+    for (auto i = first_row; i < last_row; ++i) {
+        const auto& joined_row = (*joined_rows)[row_order[i]];
+        auto& row = results.emplace_back();
+        row.reserve(plan.joined_columns.size());
+
+        for (const auto& [table_index, column_index] : plan.joined_columns) {
+            const auto& position = joined_row[table_index];
+
+            if (position) row.push_back(tables.at(table_index)->columns[column_index].get_value(*position));
+            else row.emplace_back("");
         }
     }
 
-    return data;
+    if (parser.profiler) {
+        parser.profiler->record(
+            describe_output(statement, plan.joined_columns.size()),
+            row_order.size(), results.size(), get_rows_bytes(results), start);
+    }
+
+    print_rows(results);
 }
 
-auto SelectParser::get_select_full_join_result(
-    const std::vector<std::string>& query_elements,
-    const std::vector<std::string>& column_names
-) const -> std::vector<std::vector<std::string>> {
+auto SelectParser::get_filtered_joined_rows(
+    const SelectStatement& statement,
+    const SelectPlan& plan,
+    const std::size_t max_rows
+) const -> std::optional<std::vector<JoinedRow>> {
+    const auto& tables = plan.tables;
+
+    auto table_positions = std::vector<std::optional<std::vector<std::size_t>>>(tables.size());
+    auto residual_conjuncts = std::vector<std::size_t>{};
+
+    if (statement.where) {
+        const auto pushed_table_indices = push_down_conjuncts(*statement.where, tables, statement.joins);
+        if (!pushed_table_indices) return std::nullopt;
+
+        const auto conjuncts = statement.where->get_conjuncts();
+        auto table_conjuncts = std::vector<std::vector<std::size_t>>(tables.size());
+
+        for (auto i = std::size_t{0}; i < conjuncts.size(); ++i) {
+            if (pushed_table_indices->at(i)) table_conjuncts[*pushed_table_indices->at(i)].push_back(conjuncts[i]);
+            else residual_conjuncts.push_back(conjuncts[i]);
+        }
+
+        const auto where_clause_parser = WhereClauseParser(parser);
 
-    const auto from_clause_index = find_index(query_elements, "FROM");
-    const auto full_clause_index = find_index(query_elements, "FULL");
-    const auto join_clause_index = find_index(query_elements, "JOIN");
-    const auto on_clause_index = find_index(query_elements, "ON");
+        for (auto table_index = std::size_t{0}; table_index < tables.size(); ++table_index) {
+            if (table_conjuncts[table_index].empty()) continue;
 
-    if (!is_valid_select_join_query(full_clause_index, join_clause_index, on_clause_index)) {
-        fmt::println("Query with SELECT and FULL clause should contain JOIN and ON clauses!");
-        return {};
+            table_positions[table_index] = where_clause_parser.get_positions_filtered_by(
+                *tables.at(table_index), *statement.where, table_conjuncts[table_index]);
+        }
+    }
+
+    auto row_counts = std::vector<std::size_t>{};
+    for (auto table_index = std::size_t{0}; table_index < tables.size(); ++table_index) {
+        const auto& positions = table_positions[table_index];
+        row_counts.push_back(positions ? positions->size() : tables.at(table_index)->row_count());
     }
 
-    auto table_names = std::vector(query_elements.begin() + from_clause_index + 1, query_elements.begin() +  full_clause_index);
-    table_names.emplace_back(query_elements.at(join_clause_index + 1));
+    const auto join_plan = plan_joins(statement, tables, row_counts);
+    if (!join_plan) return std::nullopt;
+
+    if (is_plan_only()) {
+        record_join_plan(*join_plan, tables, table_positions, row_counts);
+        if (!residual_conjuncts.empty()) parser.profiler->record(describe_joined_filter(*statement.where, residual_conjuncts));
+
+        return std::vector<JoinedRow>{};
+    }
 
-    const auto& left = query_elements.at(on_clause_index + 1);
-    const auto& right = query_elements.at(on_clause_index + 3);
+    if (residual_conjuncts.empty()) return get_joined_rows(*join_plan, tables, table_positions, max_rows);
 
-    if (!validate_tables_and_columns(left, right, query_elements)) return {};
+    const auto joined_rows = get_joined_rows(*join_plan, tables, table_positions, std::numeric_limits<std::size_t>::max());
+    const auto start = QueryProfiler::checkpoint();
+    auto filtered_rows = filter_joined_rows(joined_rows, *statement.where, residual_conjuncts, tables, max_rows);
 
-    if (column_names.size() == 1 and column_names.at(0) == "*") {
-        return get_all_columns_for_join(left, right, JoinType::FULL);
+    if (parser.profiler && filtered_rows) {
+        parser.profiler->record(
+            describe_joined_filter(*statement.where, residual_conjuncts),
+            joined_rows.size(), filtered_rows->size(), get_joined_rows_bytes(*filtered_rows), start);
     }
 
-    return get_specific_columns_for_full_join(left, right, column_names);
+    return filtered_rows;
 }
 
-auto SelectParser::get_specific_columns_for_full_join(
-    const std::string& left,
-    const std::string& right,
-    const std::vector<std::string>& column_names
-) const -> std::vector<std::vector<std::string>> {
+auto SelectParser::print_select_with_aggregation(const SelectStatement& statement, const SelectPlan& plan) const -> void {
+    const auto& tables = plan.tables;
 
-    auto data = std::vector<std::vector<std::string>>{};
-    auto seen_rows = std::set<std::vector<std::string>>{};
+    if (can_use_summaries(statement, plan)) {
+        const auto description = fmt::format("Aggregate '{}' from column summaries", tables.front()->name);
 
-    const auto [left_table_name, left_column_name] = split_string_with_dot(left);
-    const auto [right_table_name, right_column_name] = split_string_with_dot(right);
+        if (is_plan_only()) {
+            parser.profiler->record(description);
+            return;
+        }
 
-    auto left_table = parser.database->tables.find(left_table_name)->second;
-    auto right_table = parser.database->tables.find(right_table_name)->second;
+        const auto start = QueryProfiler::checkpoint();
+        auto results = std::vector<std::vector<std::string>>{};
+        if (statement.offset == 0 && statement.get_row_bound() > 0) results.push_back(get_summary_row(plan));
 
-    const auto left_column_id = Table::find_index(left_table.column_names, left_column_name);
-    const auto right_column_id = Table::find_index(right_table.column_names, right_column_name);
+        if (parser.profiler) parser.profiler->record(description, 0, results.size(), get_rows_bytes(results), start);
 
-    for (const auto& left_table_data : left_table.get_all_data()) {
+        print_rows(results);
+        return;
+    }
 
-        auto match_found = false;
+    auto group_keys = std::vector<Aggregator::GroupKey>{};
+    for (const auto& [table_index, column_index] : plan.group_columns) group_keys.push_back({&tables[table_index]->columns[column_index], table_index});
 
-        for (const auto& right_table_data : right_table.get_all_data()) {
-            if (left_table_data[left_column_id] == right_table_data[right_column_id]) {
-                auto combined_data = std::vector<std::string>{};
-                for (auto column_name : column_names) {
-                    std::erase(column_name, ',');
-                    if (const auto dot_pos = column_name.find('.'); dot_pos != std::string::npos) {
-                        const auto [t_name, c_name] = split_string_with_dot(column_name);
-                        if (t_name == left_table_name) combined_data.push_back(left_table_data[Table::find_index(left_table.column_names, c_name)]);
-                        else if (t_name == right_table_name) combined_data.push_back(right_table_data[Table::find_index(right_table.column_names, c_name)]);
-                    } else {
-                        const auto c_left_index = Table::find_index(left_table.column_names, column_name);
-                        const auto c_right_index = Table::find_index(right_table.column_names, column_name);
-
-                        if (c_left_index != -1 && c_right_index != -1) {
-                            fmt::println("Column with name '{}' exists in both tables!", column_name);
-                            return {};
-                        }
-
-                        if (c_left_index != -1) combined_data.push_back(left_table_data[Table::find_index(left_table.column_names, column_name)]);
-                        if (c_right_index != -1) combined_data.push_back(right_table_data[Table::find_index(right_table.column_names, column_name)]);
-                    }
-                }
-                if (seen_rows.insert(combined_data).second) data.push_back(combined_data);
-                match_found = true;
-            }
-        }
+    auto aggregate_columns = std::vector<Aggregator::AggregateColumn>{};
+    for (const auto& [function, column] : plan.selected_aggregates) {
+        if (column) aggregate_columns.push_back({function, &tables[column->table_index]->columns[column->column_index], column->table_index});
+        else aggregate_columns.push_back({function});
+    }
 
-        if (!match_found) {
-            auto combined_data = std::vector<std::string>{};
-            for (auto column_name : column_names) {
-                std::erase(column_name, ',');
-                if (const auto dot_pos = column_name.find('.'); dot_pos != std::string::npos) {
-                    const auto [t_name, c_name] = split_string_with_dot(column_name);
-                    if (t_name == left_table_name) combined_data.push_back(left_table_data[Table::find_index(left_table.column_names, c_name)]);
-                    else combined_data.emplace_back("");
-                } else {
-                    const auto c_left_index = Table::find_index(left_table.column_names, column_name);
-                    const auto c_right_index = Table::find_index(right_table.column_names, column_name);
-
-                    if (c_left_index != -1 && c_right_index != -1) {
-                        fmt::println("Column with name '{}' exists in both tables!", column_name);
-                        return {};
-                    }
-
-                    if (c_left_index != -1) combined_data.push_back(left_table_data[Table::find_index(left_table.column_names, column_name)]);
-                    else combined_data.emplace_back("");
-                }
-            }
-            if (seen_rows.insert(combined_data).second)data.push_back(combined_data);
+    auto aggregator = Aggregator(std::move(group_keys), std::move(aggregate_columns));
+    auto positions = std::vector<std::size_t>{};
+    auto joined_rows = std::vector<JoinedRow>{};
+
+    if (!statement.joins.empty()) {
+        auto filtered_rows = get_filtered_joined_rows(statement, plan, std::numeric_limits<std::size_t>::max());
+        if (!filtered_rows) return;
+
+        joined_rows = std::move(*filtered_rows);
+    } else {
+        const auto& table = *tables.front();
+
+        if (statement.where) positions = WhereClauseParser(parser).get_positions_filtered_by(table, *statement.where);
+        else {
+            const auto start = QueryProfiler::checkpoint();
+            positions.resize(table.row_count());
+            std::iota(positions.begin(), positions.end(), std::size_t{0});
+
+            if (parser.profiler) parser.profiler->record(fmt::format("Scan '{}'", table.name), table.row_count(), positions.size(), positions.capacity() * sizeof(std::size_t), start);
         }
     }
 
-    for (const auto& right_table_data : right_table.get_all_data()) {
+    if (is_plan_only()) {
+        parser.profiler->record(describe_aggregate(statement));
+        record_planned_stages(statement, plan, statement.joins.empty() ? positions.size() : std::numeric_limits<std::size_t>::max(), plan.selected_aggregates.size());
+        return;
+    }
 
-        auto match_found = false;
+    const auto aggregate_start = QueryProfiler::checkpoint();
 
-        for (const auto& left_table_data : left_table.get_all_data()) {
-            if (right_table_data[right_column_id] == left_table_data[left_column_id]) {
-                auto combined_data = std::vector<std::string>{};
-                for (auto column_name : column_names) {
-                    std::erase(column_name, ',');
-                    if (const auto dot_pos = column_name.find('.'); dot_pos != std::string::npos) {
-                        const auto [t_name, c_name] = split_string_with_dot(column_name);
-                        if (t_name == left_table_name) combined_data.push_back(left_table_data[Table::find_index(left_table.column_names, c_name)]);
-                        else if (t_name == right_table_name) combined_data.push_back(right_table_data[Table::find_index(right_table.column_names, c_name)]);
-                    } else {
-                        const auto c_left_index = Table::find_index(left_table.column_names, column_name);
-                        const auto c_right_index = Table::find_index(right_table.column_names, column_name);
-
-                        if (c_left_index != -1 && c_right_index != -1) {
-                            fmt::println("Column with name '{}' exists in both tables!", column_name);
-                            return {};
-                        }
-
-                        if (c_left_index != -1) combined_data.push_back(left_table_data[Table::find_index(left_table.column_names, column_name)]);
-                        if (c_right_index != -1) combined_data.push_back(right_table_data[Table::find_index(right_table.column_names, column_name)]);
-                    }
-                }
-                if (seen_rows.insert(combined_data).second)data.push_back(combined_data);
-                match_found = true;
-            }
-        }
+    if (statement.joins.empty()) aggregator.aggregate(positions);
+    else aggregator.aggregate(joined_rows);
 
-        if (!match_found) {
-            auto combined_data = std::vector<std::string>{};
-            for (auto column_name : column_names) {
-                std::erase(column_name, ',');
-                if (const auto dot_pos = column_name.find('.'); dot_pos != std::string::npos) {
-                    const auto [t_name, c_name] = split_string_with_dot(column_name);
-                    if (t_name == right_table_name) combined_data.push_back(right_table_data[Table::find_index(right_table.column_names, c_name)]);
-                    else combined_data.emplace_back("");
-                } else {
-                    const auto c_left_index = Table::find_index(left_table.column_names, column_name);
-                    const auto c_right_index = Table::find_index(right_table.column_names, column_name);
-
-                    if (c_left_index != -1 && c_right_index != -1) {
-                        fmt::println("Column with name '{}' exists in both tables!", column_name);
-                        return {};
-                    }
-
-                    if (c_right_index != -1) combined_data.push_back(right_table_data[Table::find_index(right_table.column_names, column_name)]);
-                    else combined_data.emplace_back("");
-                }
-            }
-            if (seen_rows.insert(combined_data).second) data.push_back(combined_data);
-        }
+    const auto& group_rows = aggregator.get_group_rows();
+
+    if (parser.profiler) {
+        parser.profiler->record(
+            describe_aggregate(statement),
+            statement.joins.empty() ? positions.size() : joined_rows.size(), group_rows.size(), aggregator.get_allocated_bytes(), aggregate_start);
     }
 
-    return data;
-}
+    const auto row_bound = statement.get_row_bound();
 
-auto SelectParser::get_all_columns_for_join(
-    const std::string &left,
-    const std::string &right,
-    const JoinType& join_type
-) const -> std::vector<std::vector<std::string>> {
-    auto data = std::vector<std::vector<std::string>>{};
-    auto seen_rows = std::set<std::vector<std::string>>{};
+    const auto position_of = [&](const std::size_t group, const std::size_t table_index) {
+        const auto row = group_rows[group];
+        return statement.joins.empty() ? std::optional{positions[row]} : joined_rows[row][table_index];
+    };
 
-    const auto [left_table_name, left_column_name] = split_string_with_dot(left);
-    const auto [right_table_name, right_column_name] = split_string_with_dot(right);
+    auto groups = std::vector<std::size_t>(group_rows.size());
+    std::iota(groups.begin(), groups.end(), std::size_t{0});
 
-    auto left_table = parser.database->tables.find(left_table_name)->second;
-    auto right_table = parser.database->tables.find(right_table_name)->second;
+    if (statement.is_distinct) {
+        const auto start = QueryProfiler::checkpoint();
+        const auto& selected_aggregates = plan.selected_aggregates;
+        const auto get_column = [&](const JoinedColumn& column) -> const Column& {
+            return tables[column.table_index]->columns[column.column_index];
+        };
 
-    const auto left_column_id = Table::find_index(left_table.column_names, left_column_name);
-    const auto right_column_id = Table::find_index(right_table.column_names, right_column_name);
+        const auto max_rows = plan.order_keys.empty() ? row_bound : std::numeric_limits<std::size_t>::max();
 
-    for (auto left_table_data : left_table.get_all_data()) {
-        auto match_found = false;
+        DistinctFilter::filter(
+            groups,
+            max_rows,
+            [&](const std::size_t group) {
+                auto hash = std::size_t{0};
 
-        for (auto right_table_data : right_table.get_all_data()) {
-            if (left_table_data[left_column_id] == right_table_data[right_column_id]) {
-                auto combined_data = std::vector<std::string>{};
-                for (const auto& element : left_table_data) combined_data.push_back(element);
-                for (const auto& element : right_table_data) combined_data.push_back(element);
-                if (seen_rows.insert(combined_data).second) data.push_back(combined_data);
-                match_found = true;
-            }
-        }
+                for (auto i = std::size_t{0}; i < selected_aggregates.size(); ++i) {
+                    const auto& [function, column] = selected_aggregates[i];
+                    const auto value_hash = function == AggregateFunction::NONE ?
+                        hash_value(get_column(*column), position_of(group, column->table_index)) :
+                        std::hash<std::string>{}(aggregator.get_value(group, i));
+
+                    hash = (hash ^ value_hash) * 0x100000001B3ULL;
+                }
 
-        if (!match_found) {
-            auto combined_data = std::vector<std::string>{};
-            for (const auto& element : left_table_data) combined_data.push_back(element);
+                return hash;
+            },
+            [&](const std::size_t group, const std::size_t other_group) {
+                for (auto i = std::size_t{0}; i < selected_aggregates.size(); ++i) {
+                    const auto& [function, column] = selected_aggregates[i];
+                    const auto is_equal = function == AggregateFunction::NONE ?
+                        RowSorter::compare_values(get_column(*column), position_of(group, column->table_index), position_of(other_group, column->table_index)) == 0 :
+                        aggregator.get_value(group, i) == aggregator.get_value(other_group, i);
 
-            if (join_type == JoinType::LEFT || join_type == JoinType::FULL) {
-                for (auto i = 0; i < right_table.column_names.size(); i++) combined_data.emplace_back("");
-            }
+                    if (!is_equal) return false;
+                }
 
-            if (join_type == JoinType::FULL) {
-                if (seen_rows.insert(combined_data).second) data.push_back(combined_data);
-            } else if (join_type == JoinType::LEFT) data.push_back(combined_data);
+                return true;
+            });
+
+        if (parser.profiler) {
+            parser.profiler->record(
+                "Hash distinct",
+                group_rows.size(), groups.size(), DistinctFilter::get_table_bytes(group_rows.size(), max_rows), start);
         }
     }
 
-    if (join_type == JoinType::RIGHT || join_type == JoinType::FULL) {
-        for (auto right_table_data : right_table.get_all_data()) {
-            bool match_found = false;
-            for (auto& left_table_data : left_table.get_all_data()) {
-                if (right_table_data[right_column_id] == left_table_data[left_column_id]) {
-                    match_found = true;
-                    break;
-                }
-            }
+    if (!plan.order_keys.empty()) {
+        const auto start = QueryProfiler::checkpoint();
+        const auto rows_in = groups.size();
+        get_row_sorter(plan).sort(groups, row_bound, position_of);
+
+        if (parser.profiler) {
+            parser.profiler->record(
+                describe_sort(statement, plan, rows_in),
+                rows_in, groups.size(), RowSorter::get_buffer_bytes(rows_in, row_bound), start);
+        }
+    }
 
-            if (!match_found) {
-                auto combined_data = std::vector<std::string>{};
-                for (auto i = 0; i < left_table.column_names.size(); i++) combined_data.emplace_back("");
-                for (const auto& element : right_table_data) combined_data.push_back(element);
+    const auto start = QueryProfiler::checkpoint();
+    const auto first_group = std::min(statement.offset, groups.size());
+    const auto last_group = std::min(row_bound, groups.size());
 
-                if (seen_rows.insert(combined_data).second) data.push_back(combined_data);
-            }
+    auto results = std::vector<std::vector<std::string>>{};
+    results.reserve(last_group - first_group);
+
+    for (auto i = first_group; i < last_group; ++i) {
+        auto& row = results.emplace_back();
+        row.reserve(plan.selected_aggregates.size());
+
+        for (auto column_index = std::size_t{0}; column_index < plan.selected_aggregates.size(); ++column_index) {
+            row.push_back(aggregator.get_value(groups[i], column_index));
         }
     }
 
-    return data;
+    if (parser.profiler) {
+        parser.profiler->record(
+            describe_output(statement, plan.selected_aggregates.size()),
+            groups.size(), results.size(), get_rows_bytes(results), start);
+    }
+
+    print_rows(results);
+}
+
+auto SelectParser::print_rows(const std::vector<std::vector<std::string>>& rows) const -> void {
+    if (!parser.profiler) fmt::println("{}", rows);
+}
+
+auto SelectParser::get_rows_bytes(const std::vector<std::vector<std::string>>& rows) -> std::size_t {
+    auto bytes = rows.capacity() * sizeof(std::vector<std::string>);
+
+    for (const auto& row : rows) {
+        bytes += row.capacity() * sizeof(std::string);
+        for (const auto& value : row) bytes += value.capacity() > std::string().capacity() ? value.capacity() + 1 : 0;
+    }
+
+    return bytes;
+}
+
+auto SelectParser::get_joined_rows_bytes(const std::vector<JoinedRow>& joined_rows) -> std::size_t {
+    auto bytes = joined_rows.capacity() * sizeof(JoinedRow);
+    for (const auto& joined_row : joined_rows) bytes += joined_row.capacity() * sizeof(std::optional<std::size_t>);
+
+    return bytes;
+}
+
+auto SelectParser::get_join_step_bytes(
+    const JoinInput& left,
+    const JoinInput& right,
+    const std::vector<JoinMatch>& matches,
+    const JoinAlgorithm join_algorithm
+) -> std::size_t {
+    const auto input_rows = left.positions.size() + right.positions.size();
+    const auto algorithm_bytes = join_algorithm == JoinAlgorithm::HASH ?
+        std::min(left.positions.size(), right.positions.size()) * hash_join_bytes_per_row :
+        input_rows * sizeof(std::size_t);
+
+    return (left.positions.capacity() + right.positions.capacity()) * sizeof(std::optional<std::size_t>) +
+        matches.capacity() * sizeof(JoinMatch) + algorithm_bytes;
 }
 
-auto SelectParser::print_appropriate_columns_without_joins(
-    const std::vector<std::string>& query_elements
+auto SelectParser::is_plan_only() const -> bool {
+    return parser.profiler && !parser.profiler->is_analyze;
+}
+
+auto SelectParser::record_planned_stages(
+    const SelectStatement& statement,
+    const SelectPlan& plan,
+    const std::size_t row_count,
+    const std::size_t column_count
 ) const -> void {
-    const auto database = parser.database;
-    const auto where_clause_parser = WhereClauseParser(parser);
-    auto flattened_results = std::vector<std::vector<std::string>>{};
+    if (statement.is_distinct) parser.profiler->record("Hash distinct");
+    if (!plan.order_keys.empty()) parser.profiler->record(describe_sort(statement, plan, row_count));
 
-    const auto from_clause_index = find_index(query_elements, "FROM");
-    const auto where_clause_index = find_index(query_elements, "WHERE");
+    parser.profiler->record(describe_output(statement, column_count));
+}
 
-    const auto column_names = std::vector(query_elements.begin() + 1, query_elements.begin() + from_clause_index);
-    auto table_names = std::vector(query_elements.begin() + from_clause_index + 1,
-        where_clause_index == -1 ? query_elements.end() : query_elements.begin() + where_clause_index);
+auto SelectParser::describe_aggregate(const SelectStatement& statement) -> std::string {
+    if (statement.group_by.empty()) return "Aggregate";
 
-    if (where_clause_index == -1) {
-        for (auto table_name : table_names) {
-            std::erase(table_name, ',');
+    auto group_columns = std::vector<std::string>{};
+    for (const auto& column : statement.group_by) group_columns.push_back(column.full_name());
 
-            if (!database->tables.contains(table_name)) {
-                fmt::println("Table with name '{}' doesn't exist in database '{}'!", table_name, database->name);
-                return;
-            }
+    return fmt::format("Hash aggregate by {}", fmt::join(group_columns, ", "));
+}
 
-            auto data_from_table = column_names.size() == 1 && column_names.at(0) == "*" ?
-                database->tables.find(table_name)->second.get_all_data() :
-                database->tables.find(table_name)->second.get_all_data_from(
-                    column_names, database->tables.find(table_name)->second.get_all_data());
-            flattened_results.insert(flattened_results.end(), data_from_table.begin(), data_from_table.end());
-        }
+auto SelectParser::describe_joined_filter(const WhereClause& where, const std::vector<std::size_t>& conjuncts) -> std::string {
+    auto conditions = std::vector<std::string>{};
+    for (const auto conjunct : conjuncts) conditions.push_back(where.to_string(conjunct));
 
-        fmt::println("{}", flattened_results);
+    return fmt::format("Filter joined rows: {}", fmt::join(conditions, " AND "));
+}
 
-        return;
+auto SelectParser::describe_join_step(
+    const JoinStep& step,
+    const std::vector<const Table*>& tables,
+    const JoinAlgorithm join_algorithm
+) -> std::string {
+    const auto& left_table = *tables[step.left.table_index];
+    const auto& right_table = *tables[step.table_index];
+
+    return fmt::format(
+        "{} join {}: {}.{} = {}.{}",
+        join_algorithm == JoinAlgorithm::HASH ? "Hash" : "Merge", join_type_to_string(step.type),
+        left_table.name, left_table.column_names[step.left.column_index],
+        right_table.name, right_table.column_names[step.right_column_index]);
+}
+
+auto SelectParser::describe_sort(const SelectStatement& statement, const SelectPlan& plan, const std::size_t row_count) -> std::string {
+    auto keys = std::vector<std::string>{};
+
+    for (const auto& [column, is_descending] : plan.order_keys) {
+        const auto& table = *plan.tables[column.table_index];
+        keys.push_back(fmt::format("{}.{}{}", table.name, table.column_names[column.column_index], is_descending ? " DESC" : ""));
     }
 
-    auto results_and_comparison_operators = std::vector<std::vector<std::vector<std::string>>>{};
-    for (auto it = query_elements.begin() + where_clause_index + 1; it + 2 < query_elements.end(); it += 4) {
-        const auto& condition_column_name = *it;
-        const auto& comparison_operator = *(it + 1);
-        const auto& condition_column_value = *(it + 2);
+    const auto row_bound = statement.get_row_bound();
+    if (row_bound < row_count) return fmt::format("Top-{} heap sort by {}", row_bound, fmt::join(keys, ", "));
 
-        if (comparison_operator == "=") {
-            results_and_comparison_operators.push_back(
-                where_clause_parser.get_data_filtered_by_equality(
-                    table_names, column_names, condition_column_name, condition_column_value, false, {}));
-        }
+    return fmt::format("Sort by {}", fmt::join(keys, ", "));
+}
 
-        if (comparison_operator == "<>" || comparison_operator == "!=") {
-            results_and_comparison_operators.push_back(
-                where_clause_parser.get_data_filtered_by_inequality(
-                    table_names, column_names, condition_column_name, condition_column_value, false, {}));
-        }
+auto SelectParser::describe_output(const SelectStatement& statement, const std::size_t column_count) -> std::string {
+    const auto columns = fmt::format("{} column{}", column_count, column_count == 1 ? "" : "s");
 
-        if (comparison_operator == ">") {
-            results_and_comparison_operators.push_back(
-                where_clause_parser.get_data_filtered_by_greater_than(
-                    table_names, column_names, condition_column_name, condition_column_value, false, {}));
-        }
+    if (!statement.limit && statement.offset == 0) return fmt::format("Project {}", columns);
+    if (!statement.limit) return fmt::format("Offset {}, project {}", statement.offset, columns);
 
-        if (comparison_operator == ">=") {
-            results_and_comparison_operators.push_back(
-                where_clause_parser.get_data_filtered_by_greater_than_or_equal(
-                    table_names, column_names, condition_column_name, condition_column_value, false, {}));
-        }
+    return fmt::format("Limit {} offset {}, project {}", *statement.limit, statement.offset, columns);
+}
 
-        if (comparison_operator == "<") {
-            results_and_comparison_operators.push_back(
-                where_clause_parser.get_data_filtered_by_less_than(
-                    table_names, column_names, condition_column_name, condition_column_value, false, {}));
-        }
+auto SelectParser::can_use_summaries(const SelectStatement& statement, const SelectPlan& plan) -> bool {
+    if (!statement.joins.empty() || statement.where || !plan.group_columns.empty()) return false;
+
+    return std::ranges::all_of(plan.selected_aggregates, [](const SelectedAggregate& aggregate) {
+        const auto& [function, column] = aggregate;
+        return !column || function == AggregateFunction::COUNT || function == AggregateFunction::MIN || function == AggregateFunction::MAX;
+    });
+}
+
+auto SelectParser::get_summary_row(const SelectPlan& plan) -> std::vector<std::string> {
+    const auto& table = *plan.tables.front();
+    auto row = std::vector<std::string>{};
 
-        if (comparison_operator == "<=") {
-            results_and_comparison_operators.push_back(
-                where_clause_parser.get_data_filtered_by_less_than_or_equal(
-                    table_names, column_names, condition_column_name, condition_column_value, false, {}));
+    for (const auto& [function, column] : plan.selected_aggregates) {
+        if (!column) {
+            row.push_back(std::to_string(table.row_count()));
+            continue;
         }
 
-        if (comparison_operator == "LIKE") {
-            results_and_comparison_operators.push_back(
-                where_clause_parser.get_data_filtered_by_like(
-                    table_names, column_names, condition_column_name, condition_column_value, false, {}));
+        const auto& summary = table.column_summaries[column->column_index];
+
+        switch (function) {
+            case AggregateFunction::COUNT: row.push_back(std::to_string(table.row_count() - summary.null_count)); break;
+            case AggregateFunction::MIN: row.push_back(summary.get_min()); break;
+            default: row.push_back(summary.get_max()); break;
         }
+    }
 
-        if (it + 3 < query_elements.end()) results_and_comparison_operators.push_back({{*(it + 3)}});
+    return row;
+}
+
+auto SelectParser::filter_distinct_positions(
+    std::vector<std::size_t>& positions,
+    const Table& table,
+    const std::vector<int>& column_indices,
+    const std::size_t max_rows
+) -> void {
+    auto columns = std::vector<const Column*>{};
+    for (const auto column_index : column_indices) {
+        if (column_index != -1) columns.push_back(&table.columns[column_index]);
     }
 
-    if (results_and_comparison_operators.size() == 1 && results_and_comparison_operators.at(0).empty()) {
-        fmt::println("{}", results_and_comparison_operators.at(0));
-        return;
+    DistinctFilter::filter(
+        positions,
+        max_rows,
+        [&](const std::size_t position) {
+            auto hash = std::size_t{0};
+            for (const auto* column : columns) hash = (hash ^ column->hash(position)) * 0x100000001B3ULL;
+
+            return hash;
+        },
+        [&](const std::size_t position, const std::size_t other_position) {
+            return std::ranges::all_of(columns, [&](const Column* column) { return column->equals(position, *column, other_position); });
+        });
+}
+
+auto SelectParser::filter_distinct_rows(
+    std::vector<std::size_t>& rows,
+    const std::vector<JoinedRow>& joined_rows,
+    const std::vector<JoinedColumn>& joined_columns,
+    const std::vector<const Table*>& tables,
+    const std::size_t max_rows
+) -> void {
+    DistinctFilter::filter(
+        rows,
+        max_rows,
+        [&](const std::size_t row) {
+            auto hash = std::size_t{0};
+
+            for (const auto& [table_index, column_index] : joined_columns) {
+                hash = (hash ^ hash_value(tables[table_index]->columns[column_index], joined_rows[row][table_index])) * 0x100000001B3ULL;
+            }
+
+            return hash;
+        },
+        [&](const std::size_t row, const std::size_t other_row) {
+            return std::ranges::all_of(joined_columns, [&](const JoinedColumn& column) {
+                const auto& [table_index, column_index] = column;
+                return RowSorter::compare_values(tables[table_index]->columns[column_index], joined_rows[row][table_index], joined_rows[other_row][table_index]) == 0;
+            });
+        });
+}
+
+auto SelectParser::hash_value(const Column& column, const std::optional<std::size_t> position) -> std::size_t {
+    return position ? column.hash(*position) : Column::null_hash;
+}
+
+auto SelectParser::resolve_order_keys(
+    const SelectStatement& statement,
+    const std::vector<const Table*>& tables
+) -> std::optional<std::vector<OrderKey>> {
+    auto order_keys = std::vector<OrderKey>{};
+
+    for (const auto& [column, is_descending] : statement.order_by) {
+        const auto joined_column = resolve_joined_column(column, tables);
+        if (!joined_column) return std::nullopt;
+
+        order_keys.push_back({*joined_column, is_descending});
     }
 
-    auto results = std::vector<std::vector<std::string>>{};
-    auto current_comparison_operator = std::string("");
-    for (auto part : results_and_comparison_operators) {
+    return order_keys;
+}
 
-        if (part.empty() && (current_comparison_operator == "&&" || current_comparison_operator == "AND")) {
-            results.clear();
-            current_comparison_operator.clear();
-            continue;
-        }
+auto SelectParser::get_row_sorter(const SelectPlan& plan) -> RowSorter {
+    auto keys = std::vector<RowSorter::SortKey>{};
 
-        if (part.empty() && (current_comparison_operator == "||" || current_comparison_operator == "OR")) continue;
+    for (const auto& [column, is_descending] : plan.order_keys) {
+        keys.push_back({&plan.tables[column.table_index]->columns[column.column_index], column.table_index, is_descending});
+    }
 
-        if (part.at(0).size() == 1 && (
-                part.at(0).at(0) == "&&" ||
-                part.at(0).at(0) == "||" ||
-                part.at(0).at(0) == "AND" ||
-                part.at(0).at(0) == "OR")
-            ) {
-            current_comparison_operator = part.at(0).at(0);
-            continue;
-        }
+    return RowSorter(std::move(keys));
+}
 
-        for (auto& row : part) {
-            if (current_comparison_operator.empty()) results.push_back(row);
-            else {
-                if (current_comparison_operator == "&&" || current_comparison_operator == "AND") {
-                    auto temp_results = std::vector<std::vector<std::string>>{};
+auto SelectParser::get_joined_tables(const SelectStatement& statement) const -> std::optional<std::vector<const Table*>> {
+    if (statement.table_names.size() != 1) {
+        fmt::println("Query with JOIN clause should contain exactly one table name after FROM clause!");
+        return std::nullopt;
+    }
 
-                    for (const auto& existing_row : results) {
-                        if (std::ranges::find(part, existing_row) != part.end()) temp_results.push_back(existing_row);
-                    }
+    auto table_names = statement.table_names;
+    for (const auto& join : statement.joins) table_names.push_back(join.table_name);
 
-                    results = temp_results;
+    auto tables = std::vector<const Table*>{};
 
-                    if (results.empty()) break;
-                }
+    for (const auto& table_name : table_names) {
+        if (!parser.database->tables.contains(table_name)) {
+            fmt::println("Table with name '{}' not exists in database '{}'!", table_name, parser.database->name);
+            return std::nullopt;
+        }
 
-                if (current_comparison_operator == "||" || current_comparison_operator == "OR") {
-                    if (std::ranges::find(results, row) == results.end()) results.push_back(row);
-                }
-            }
+        const auto& table = parser.database->tables.find(table_name)->second;
+
+        if (std::ranges::find(tables, &table) != tables.end()) {
+            fmt::println("Table with name '{}' is joined more than once!", table_name);
+            return std::nullopt;
         }
 
-        current_comparison_operator.clear();
+        tables.push_back(&table);
     }
 
-    fmt::println("{}", results);
+    return tables;
 }
 
-auto SelectParser::print_appropriate_columns_with_joins(
-    const std::vector<std::string>& query_elements,
-    const std::vector<std::string>& column_names
-) const -> void {
+auto SelectParser::plan_joins(
+    const SelectStatement& statement,
+    const std::vector<const Table*>& tables,
+    const std::vector<std::size_t>& row_counts
+) -> std::optional<JoinPlan> {
+    auto steps = std::vector<JoinStep>{};
 
-    const auto where_clause_parser = WhereClauseParser(parser);
-    auto select_results = std::vector<std::vector<std::string>>{};
-    auto flattened_results = std::vector<std::vector<std::string>>{};
+    for (auto i = std::size_t{0}; i < statement.joins.size(); ++i) {
+        const auto& join = statement.joins[i];
+        const auto table_index = i + 1;
+        const auto visible_tables = std::vector<const Table*>(tables.begin(), tables.begin() + table_index + 1);
 
-    const auto from_clause_index = find_index(query_elements, "FROM");
-    const auto inner_clause_index = find_index(query_elements, "INNER");
-    const auto left_clause_index = find_index(query_elements, "LEFT");
-    const auto right_clause_index = find_index(query_elements, "RIGHT");
-    const auto full_clause_index = find_index(query_elements, "FULL");
-    const auto join_clause_index = find_index(query_elements, "JOIN");
-    const auto where_clause_index = find_index(query_elements, "WHERE");
+        auto left = resolve_joined_column(join.left, visible_tables);
+        if (!left) return std::nullopt;
 
-    auto table_names = std::vector<std::string>{};
+        auto right = resolve_joined_column(join.right, visible_tables);
+        if (!right) return std::nullopt;
 
-    if (inner_clause_index != -1) {
-        select_results = get_select_inner_join_result(query_elements, column_names);
-        table_names = std::vector(query_elements.begin() + from_clause_index + 1, query_elements.begin() +  inner_clause_index);
-        table_names.emplace_back(query_elements.at(join_clause_index + 1));
-    }
+        if (left->table_index == table_index) std::swap(left, right);
+
+        if (right->table_index != table_index || left->table_index == table_index) {
+            fmt::println("Condition after ON clause should compare column of table '{}' with column of previously joined table!", join.table_name);
+            return std::nullopt;
+        }
 
-    if (left_clause_index != -1) {
-        select_results = get_select_left_join_result(query_elements, column_names);
-        table_names = std::vector(query_elements.begin() + from_clause_index + 1, query_elements.begin() +  left_clause_index);
-        table_names.emplace_back(query_elements.at(join_clause_index + 1));
+        steps.push_back({join.type, table_index, *left, right->column_index});
     }
 
-    if (right_clause_index != -1) {
-        select_results = get_select_right_join_result(query_elements, column_names);
-        table_names = std::vector(query_elements.begin() + from_clause_index + 1, query_elements.begin() +  right_clause_index);
-        table_names.emplace_back(query_elements.at(join_clause_index + 1));
+    const auto are_inner_joins = std::ranges::all_of(steps, [](const auto& step) { return step.type == JoinType::INNER; });
+    if (are_inner_joins && steps.size() > 1) return reorder_inner_joins(steps, tables, row_counts);
+
+    return JoinPlan{0, steps};
+}
+
+auto SelectParser::reorder_inner_joins(
+    const std::vector<JoinStep>& steps,
+    const std::vector<const Table*>& tables,
+    const std::vector<std::size_t>& row_counts
+) -> JoinPlan {
+    auto plan = JoinPlan{};
+
+    for (auto i = std::size_t{1}; i < tables.size(); ++i) {
+        if (row_counts[i] < row_counts[plan.first_table_index]) plan.first_table_index = i;
     }
 
-    if (full_clause_index != -1) {
-        select_results = get_select_full_join_result(query_elements, column_names);
-        table_names = std::vector(query_elements.begin() + from_clause_index + 1, query_elements.begin() + full_clause_index);
-        table_names.emplace_back(query_elements.at(join_clause_index + 1));
+    auto is_table_joined = std::vector<bool>(tables.size());
+    auto is_step_planned = std::vector<bool>(steps.size());
+    auto estimated_rows = static_cast<double>(row_counts[plan.first_table_index]);
+    is_table_joined[plan.first_table_index] = true;
+
+    while (plan.steps.size() < steps.size()) {
+        auto best_step = JoinStep{};
+        auto best_step_index = std::size_t{0};
+        auto best_estimated_rows = std::numeric_limits<double>::max();
+
+        for (auto i = std::size_t{0}; i < steps.size(); ++i) {
+            const auto& step = steps[i];
+            const auto is_left_joined = is_table_joined[step.left.table_index];
+            if (is_step_planned[i] || is_left_joined == is_table_joined[step.table_index]) continue;
+
+            const auto candidate = is_left_joined ? step :
+                JoinStep{JoinType::INNER, step.left.table_index, {step.table_index, step.right_column_index}, step.left.column_index};
+            const auto candidate_rows = estimate_joined_rows(candidate, tables, row_counts, estimated_rows);
+
+            if (candidate_rows < best_estimated_rows) {
+                best_step = candidate;
+                best_step_index = i;
+                best_estimated_rows = candidate_rows;
+            }
+        }
+
+        is_step_planned[best_step_index] = true;
+        is_table_joined[best_step.table_index] = true;
+        estimated_rows = best_estimated_rows;
+        plan.steps.push_back(best_step);
     }
 
-    if (where_clause_index == -1) {
-        fmt::println("{}", select_results);
-        return;
+    return plan;
+}
+
+auto SelectParser::estimate_joined_rows(
+    const JoinStep& step,
+    const std::vector<const Table*>& tables,
+    const std::vector<std::size_t>& row_counts,
+    const double left_rows
+) -> double {
+    const auto joined_rows = row_counts[step.table_index];
+
+    const auto distinct_values = std::max({
+        std::min(estimate_distinct_values(*tables[step.left.table_index], step.left.column_index), row_counts[step.left.table_index]),
+        std::min(estimate_distinct_values(*tables[step.table_index], step.right_column_index), joined_rows),
+        std::size_t{1}
+    });
+
+    return left_rows * static_cast<double>(joined_rows) / static_cast<double>(distinct_values);
+}
+
+auto SelectParser::estimate_distinct_values(const Table& table, const int column_index) -> std::size_t {
+    const auto row_count = table.row_count();
+    if (row_count == 0 || table.unique_indexes.at(column_index)) return row_count;
+
+    const auto& column = table.columns[column_index];
+    const auto key_kind = get_join_key_kind(column, column);
+    const auto sample_size = std::min(row_count, distinct_values_sample_size);
+    const auto stride = row_count / sample_size;
+
+    auto sampled_hashes = std::unordered_set<std::size_t>{};
+    for (auto i = std::size_t{0}; i < sample_size; ++i) sampled_hashes.insert(hash_join_key(column, i * stride, key_kind));
+
+    const auto sampled_distinct_values = sampled_hashes.size();
+    if (sampled_distinct_values * 2 <= sample_size) return sampled_distinct_values;
+
+    return sampled_distinct_values * row_count / sample_size;
+}
+
+auto SelectParser::push_down_conjuncts(
+    const WhereClause& where,
+    const std::vector<const Table*>& tables,
+    const std::vector<JoinClause>& joins
+) -> std::optional<std::vector<std::optional<std::size_t>>> {
+    auto is_null_supplied = std::vector<bool>(tables.size());
+
+    for (auto i = std::size_t{0}; i < joins.size(); ++i) {
+        const auto table_index = i + 1;
+
+        if (joins[i].type == JoinType::LEFT || joins[i].type == JoinType::FULL) is_null_supplied[table_index] = true;
+        if (joins[i].type == JoinType::RIGHT || joins[i].type == JoinType::FULL) {
+            std::fill(is_null_supplied.begin(), is_null_supplied.begin() + table_index, true);
+        }
     }
 
-    auto results_and_comparison_operators = std::vector<std::vector<std::vector<std::string>>>{};
-    for (auto it = query_elements.begin() + where_clause_index + 1; it + 2 < query_elements.end(); it += 4) {
-        const auto& condition_column_name = *it;
-        const auto& comparison_operator = *(it + 1);
-        const auto& condition_column_value = *(it + 2);
+    auto pushed_table_indices = std::vector<std::optional<std::size_t>>{};
+
+    for (const auto conjunct : where.get_conjuncts()) {
+        auto table_index = std::optional<std::size_t>{};
+        auto is_single_table = true;
 
-        if (comparison_operator == "=") {
-            results_and_comparison_operators.push_back(
-                where_clause_parser.get_data_filtered_by_equality(
-                    table_names, column_names, condition_column_name, condition_column_value, true, select_results));
+        for (const auto condition_index : where.get_conditions(conjunct)) {
+            const auto& condition = where.expressions[condition_index].condition;
+            const auto joined_column = resolve_joined_column(condition.column, tables);
+            if (!joined_column) return std::nullopt;
+
+            if (!Predicate::is_valid_operator(condition.comparison_operator)) {
+                fmt::println("Invalid comparison operator: {}", condition.comparison_operator);
+                return std::nullopt;
+            }
+
+            if (table_index && *table_index != joined_column->table_index) is_single_table = false;
+            table_index = joined_column->table_index;
         }
 
-        if (comparison_operator == "<>" || comparison_operator == "!=") {
-            results_and_comparison_operators.push_back(
-                where_clause_parser.get_data_filtered_by_inequality(
-                    table_names, column_names, condition_column_name, condition_column_value, true, select_results));
+        const auto is_pushed = is_single_table && !is_null_supplied[*table_index];
+        pushed_table_indices.push_back(is_pushed ? table_index : std::nullopt);
+    }
+
+    return pushed_table_indices;
+}
+
+auto SelectParser::get_joined_rows(
+    const JoinPlan& plan,
+    const std::vector<const Table*>& tables,
+    const std::vector<std::optional<std::vector<std::size_t>>>& table_positions,
+    const std::size_t max_rows
+) const -> std::vector<JoinedRow> {
+    auto joined_rows = std::vector<JoinedRow>{};
+    const auto& first_positions = table_positions[plan.first_table_index];
+
+    if (first_positions) {
+        joined_rows.reserve(first_positions->size());
+
+        for (const auto position : *first_positions) {
+            auto& joined_row = joined_rows.emplace_back(tables.size());
+            joined_row[plan.first_table_index] = position;
         }
+    } else {
+        joined_rows.reserve(tables[plan.first_table_index]->row_count());
 
-        if (comparison_operator == ">") {
-            results_and_comparison_operators.push_back(
-                where_clause_parser.get_data_filtered_by_greater_than(
-                    table_names, column_names, condition_column_name, condition_column_value, true, select_results));
+        for (const auto position : tables[plan.first_table_index]->positions()) {
+            auto& joined_row = joined_rows.emplace_back(tables.size());
+            joined_row[plan.first_table_index] = position;
         }
+    }
 
-        if (comparison_operator == ">=") {
-            results_and_comparison_operators.push_back(
-                where_clause_parser.get_data_filtered_by_greater_than_or_equal(
-                    table_names, column_names, condition_column_name, condition_column_value, true, select_results));
+    for (auto i = std::size_t{0}; i < plan.steps.size(); ++i) {
+        const auto start = QueryProfiler::checkpoint();
+        const auto& step = plan.steps[i];
+        const auto& right_table = *tables[step.table_index];
+        const auto& right_filter = table_positions[step.table_index];
+
+        auto left = JoinInput{*tables[step.left.table_index], step.left.column_index, {}, false};
+        left.positions.reserve(joined_rows.size());
+        for (const auto& joined_row : joined_rows) left.positions.push_back(joined_row[step.left.table_index]);
+        left.are_table_positions = i == 0 && !first_positions;
+
+        auto right = JoinInput{right_table, step.right_column_index, {}, false};
+        right.positions.reserve(right_filter ? right_filter->size() : right_table.row_count());
+        if (right_filter) right.positions.assign(right_filter->begin(), right_filter->end());
+        else for (const auto position : right_table.positions()) right.positions.emplace_back(position);
+        right.are_table_positions = !right_filter;
+
+        const auto is_last_step = i + 1 == plan.steps.size();
+        auto join_algorithm = JoinAlgorithm::HASH;
+        const auto matches = get_join_matches(left, right, step.type, is_last_step ? max_rows : std::numeric_limits<std::size_t>::max(), join_algorithm);
+
+        auto next_joined_rows = std::vector<JoinedRow>{};
+        next_joined_rows.reserve(matches.size());
+
+        for (const auto& [left_row, right_row] : matches) {
+            auto& joined_row = left_row ? next_joined_rows.emplace_back(joined_rows[*left_row]) : next_joined_rows.emplace_back(tables.size());
+            if (right_row) joined_row[step.table_index] = right.positions[*right_row];
         }
 
-        if (comparison_operator == "<") {
-            results_and_comparison_operators.push_back(
-                where_clause_parser.get_data_filtered_by_less_than(
-                    table_names, column_names, condition_column_name, condition_column_value, true, select_results));
+        if (parser.profiler) {
+            parser.profiler->record(
+                describe_join_step(step, tables, join_algorithm),
+                left.positions.size() + right.positions.size(), next_joined_rows.size(),
+                get_join_step_bytes(left, right, matches, join_algorithm) + get_joined_rows_bytes(next_joined_rows), start);
         }
 
-        if (comparison_operator == "<=") {
-            results_and_comparison_operators.push_back(
-                where_clause_parser.get_data_filtered_by_less_than_or_equal(
-                    table_names, column_names, condition_column_name, condition_column_value, true, select_results));
+        joined_rows = std::move(next_joined_rows);
+    }
+
+    return joined_rows;
+}
+
+auto SelectParser::record_join_plan(
+    const JoinPlan& plan,
+    const std::vector<const Table*>& tables,
+    const std::vector<std::optional<std::vector<std::size_t>>>& table_positions,
+    const std::vector<std::size_t>& row_counts
+) const -> void {
+    auto left_rows = static_cast<double>(row_counts[plan.first_table_index]);
+
+    for (auto i = std::size_t{0}; i < plan.steps.size(); ++i) {
+        const auto& step = plan.steps[i];
+        const auto& left_table = *tables[step.left.table_index];
+        const auto& right_table = *tables[step.table_index];
+        const auto right_rows = static_cast<double>(row_counts[step.table_index]);
+        const auto key_kind = get_join_key_kind(left_table.columns[step.left.column_index], right_table.columns[step.right_column_index]);
+
+        const auto are_presorted = i == 0 &&
+            is_presorted(left_table, step.left.column_index, table_positions[step.left.table_index], key_kind) &&
+            is_presorted(right_table, step.right_column_index, table_positions[step.table_index], key_kind);
+        const auto join_algorithm = choose_join_algorithm(are_presorted, static_cast<std::size_t>(std::min(left_rows, right_rows)));
+
+        parser.profiler->record(describe_join_step(step, tables, join_algorithm));
+
+        const auto joined_rows = estimate_joined_rows(step, tables, row_counts, left_rows);
+        const auto keeps_unmatched_left = step.type == JoinType::LEFT || step.type == JoinType::FULL;
+        const auto keeps_unmatched_right = step.type == JoinType::RIGHT || step.type == JoinType::FULL;
+
+        left_rows = std::max({joined_rows, keeps_unmatched_left ? left_rows : 0.0, keeps_unmatched_right ? right_rows : 0.0});
+    }
+}
+
+auto SelectParser::choose_join_algorithm(const bool are_presorted, const std::size_t build_size) -> JoinAlgorithm {
+    const auto exceeds_memory_budget = build_size * hash_join_bytes_per_row > hash_join_memory_budget;
+
+    return are_presorted || exceeds_memory_budget ? JoinAlgorithm::MERGE : JoinAlgorithm::HASH;
+}
+
+auto SelectParser::get_join_matches(
+    const JoinInput& left,
+    const JoinInput& right,
+    const JoinType join_type,
+    const std::size_t max_matches,
+    JoinAlgorithm& join_algorithm
+) -> std::vector<JoinMatch> {
+    const auto key_kind = get_join_key_kind(left.table.columns[left.column_index], right.table.columns[right.column_index]);
+
+    auto left_order = get_presorted_rows(left, key_kind);
+    auto right_order = get_presorted_rows(right, key_kind);
+
+    join_algorithm = choose_join_algorithm(left_order && right_order, std::min(left.positions.size(), right.positions.size()));
+    if (join_algorithm == JoinAlgorithm::HASH) return get_hash_join_matches(left, right, key_kind, join_type, max_matches);
+
+    if (!left_order) left_order = sort_rows(left.table.columns[left.column_index], left.positions, key_kind);
+    if (!right_order) right_order = sort_rows(right.table.columns[right.column_index], right.positions, key_kind);
+
+    return get_merge_join_matches(left, *left_order, right, *right_order, key_kind, join_type, max_matches);
+}
+
+auto SelectParser::get_hash_join_matches(
+    const JoinInput& left,
+    const JoinInput& right,
+    const JoinKeyKind key_kind,
+    const JoinType join_type,
+    const std::size_t max_matches
+) -> std::vector<JoinMatch> {
+    constexpr auto no_row = std::numeric_limits<std::size_t>::max();
+
+    const auto& left_column = left.table.columns[left.column_index];
+    const auto& right_column = right.table.columns[right.column_index];
+    const auto right_codes = left_column.translate_codes(right_column);
+    const auto is_left_build = left.positions.size() < right.positions.size();
+    const auto& build_column = is_left_build ? left_column : right_column;
+    const auto& probe_column = is_left_build ? right_column : left_column;
+    const auto build_size = is_left_build ? left.positions.size() : right.positions.size();
+    const auto probe_size = is_left_build ? right.positions.size() : left.positions.size();
+
+    const auto keeps_unmatched_left = join_type == JoinType::LEFT || join_type == JoinType::FULL;
+    const auto keeps_unmatched_right = join_type == JoinType::RIGHT || join_type == JoinType::FULL;
+    const auto keeps_unmatched_build = is_left_build ? keeps_unmatched_left : keeps_unmatched_right;
+    const auto keeps_unmatched_probe = is_left_build ? keeps_unmatched_right : keeps_unmatched_left;
+
+    const auto to_position = [&](const bool is_left, const std::size_t row) {
+        return is_left ? left.positions[row] : right.positions[row];
+    };
+
+    const auto to_match = [&](const std::optional<std::size_t> build_row, const std::optional<std::size_t> probe_row) {
+        return is_left_build ? JoinMatch{build_row, probe_row} : JoinMatch{probe_row, build_row};
+    };
+
+    const auto bucket_count = std::bit_ceil(std::max(build_size, std::size_t{2}));
+    const auto bucket_shift = 64 - std::countr_zero(bucket_count);
+    const auto to_bucket = [&](const std::uint64_t hash) { return hash * 0x9E3779B97F4A7C15ULL >> bucket_shift; };
+
+    auto bucket_heads = std::vector<std::size_t>(bucket_count, no_row);
+    auto next_rows = std::vector<std::size_t>(build_size, no_row);
+    auto build_hashes = std::vector<std::size_t>(build_size);
+
+    for (auto build_row = build_size; build_row-- > 0;) {
+        const auto build_position = to_position(is_left_build, build_row);
+        if (!build_position) continue;
+
+        build_hashes[build_row] = hash_join_key(build_column, *build_position, key_kind);
+
+        auto& bucket_head = bucket_heads[to_bucket(build_hashes[build_row])];
+        next_rows[build_row] = bucket_head;
+        bucket_head = build_row;
+    }
+
+    auto matches = std::vector<JoinMatch>{};
+    auto matched_build_rows = std::vector<bool>(build_size);
+
+    for (auto probe_row = std::size_t{0}; probe_row < probe_size && matches.size() < max_matches; ++probe_row) {
+        const auto probe_position = to_position(!is_left_build, probe_row);
+        auto match_found = false;
+
+        if (probe_position) {
+            const auto probe_hash = hash_join_key(probe_column, *probe_position, key_kind);
+
+            for (auto build_row = bucket_heads[to_bucket(probe_hash)]; build_row != no_row; build_row = next_rows[build_row]) {
+                if (build_hashes[build_row] != probe_hash) continue;
+
+                const auto build_position = *to_position(is_left_build, build_row);
+                const auto left_position = is_left_build ? build_position : *probe_position;
+                const auto right_position = is_left_build ? *probe_position : build_position;
+                if (!left_column.equals(left_position, right_column, right_position, right_codes)) continue;
+
+                matches.push_back(to_match(build_row, probe_row));
+                matched_build_rows[build_row] = true;
+                match_found = true;
+            }
         }
 
-        if (comparison_operator == "LIKE") {
-            results_and_comparison_operators.push_back(
-                where_clause_parser.get_data_filtered_by_like(
-                    table_names, column_names, condition_column_name, condition_column_value, true, select_results));
+        if (!match_found && keeps_unmatched_probe) matches.push_back(to_match(std::nullopt, probe_row));
+    }
+
+    if (keeps_unmatched_build) {
+        for (auto build_row = std::size_t{0}; build_row < build_size && matches.size() < max_matches; ++build_row) {
+            if (!matched_build_rows[build_row]) matches.push_back(to_match(build_row, std::nullopt));
         }
+    }
 
-        if (it + 3 < query_elements.end()) results_and_comparison_operators.push_back({{*(it + 3)}});
+    if (matches.size() > max_matches) matches.resize(max_matches);
+
+    return matches;
+}
+
+auto SelectParser::get_merge_join_matches(
+    const JoinInput& left,
+    const std::vector<std::size_t>& left_order,
+    const JoinInput& right,
+    const std::vector<std::size_t>& right_order,
+    const JoinKeyKind key_kind,
+    const JoinType join_type,
+    const std::size_t max_matches
+) -> std::vector<JoinMatch> {
+    const auto keeps_unmatched_left = join_type == JoinType::LEFT || join_type == JoinType::FULL;
+    const auto keeps_unmatched_right = join_type == JoinType::RIGHT || join_type == JoinType::FULL;
+
+    const auto& left_column = left.table.columns[left.column_index];
+    const auto& right_column = right.table.columns[right.column_index];
+
+    const auto compare = [&](const std::size_t left_row, const std::size_t right_row) {
+        return compare_join_keys(left_column, *left.positions[left_row], right_column, *right.positions[right_row], key_kind);
+    };
+
+    auto matches = std::vector<JoinMatch>{};
+
+    if (keeps_unmatched_left) {
+        for (auto row = std::size_t{0}; row < left.positions.size(); ++row) {
+            if (!left.positions[row]) matches.emplace_back(row, std::nullopt);
+        }
     }
 
-    if (results_and_comparison_operators.size() == 1 && results_and_comparison_operators.at(0).empty()) {
-        fmt::println("{}", results_and_comparison_operators.at(0));
-        return;
+    if (keeps_unmatched_right) {
+        for (auto row = std::size_t{0}; row < right.positions.size(); ++row) {
+            if (!right.positions[row]) matches.emplace_back(std::nullopt, row);
+        }
     }
 
-    auto results = std::vector<std::vector<std::string>>{};
-    auto current_comparison_operator = std::string("");
-    for (auto part : results_and_comparison_operators) {
+    auto left_index = std::size_t{0};
+    auto right_index = std::size_t{0};
+
+    while (left_index < left_order.size() && right_index < right_order.size() && matches.size() < max_matches) {
+        const auto comparison = compare(left_order[left_index], right_order[right_index]);
 
-        if (part.empty() && (current_comparison_operator == "&&" || current_comparison_operator == "AND")) {
-            results.clear();
-            current_comparison_operator.clear();
+        if (comparison < 0) {
+            if (keeps_unmatched_left) matches.emplace_back(left_order[left_index], std::nullopt);
+            ++left_index;
             continue;
         }
 
-        if (part.empty() && (current_comparison_operator == "||" || current_comparison_operator == "OR")) continue;
-
-        if (part.at(0).size() == 1 && (
-                part.at(0).at(0) == "&&" ||
-                part.at(0).at(0) == "||" ||
-                part.at(0).at(0) == "AND" ||
-                part.at(0).at(0) == "OR")
-        ) {
-            current_comparison_operator = part.at(0).at(0);
+        if (comparison > 0) {
+            if (keeps_unmatched_right) matches.emplace_back(std::nullopt, right_order[right_index]);
+            ++right_index;
             continue;
         }
 
-        for (auto& row : part) {
-            if (current_comparison_operator.empty()) results.push_back(row);
-            else {
-                if (current_comparison_operator == "&&" || current_comparison_operator == "AND") {
-                    auto temp_results = std::vector<std::vector<std::string>>{};
+        auto left_end = left_index + 1;
+        while (left_end < left_order.size() && compare(left_order[left_end], right_order[right_index]) == 0) ++left_end;
 
-                    for (const auto& existing_row : results) {
-                        if (std::ranges::find(part, existing_row) != part.end()) temp_results.push_back(existing_row);
-                    }
+        auto right_end = right_index + 1;
+        while (right_end < right_order.size() && compare(left_order[left_index], right_order[right_end]) == 0) ++right_end;
 
-                    results = temp_results;
+        for (auto i = left_index; i < left_end; ++i) {
+            for (auto j = right_index; j < right_end; ++j) matches.emplace_back(left_order[i], right_order[j]);
+        }
 
-                    if (results.empty()) break;
-                }
+        left_index = left_end;
+        right_index = right_end;
+    }
 
-                if (current_comparison_operator == "||" || current_comparison_operator == "OR") {
-                    if (std::ranges::find(results, row) == results.end()) results.push_back(row);
-                }
-            }
-        }
+    if (keeps_unmatched_left) {
+        for (; left_index < left_order.size() && matches.size() < max_matches; ++left_index) matches.emplace_back(left_order[left_index], std::nullopt);
+    }
 
-        current_comparison_operator.clear();
+    if (keeps_unmatched_right) {
+        for (; right_index < right_order.size() && matches.size() < max_matches; ++right_index) matches.emplace_back(std::nullopt, right_order[right_index]);
     }
 
-    fmt::println("{}", results);
+    if (matches.size() > max_matches) matches.resize(max_matches);
+
+    return matches;
 }
 
-auto SelectParser::find_index(const std::vector<std::string> &vec, const std::string &value) -> int {
-    for (int i = 0; i < vec.size(); ++i) {
-        if (vec[i] == value) return i;
+auto SelectParser::get_presorted_positions(
+    const Table& table,
+    const int column_index,
+    const JoinKeyKind key_kind
+) -> std::optional<std::vector<std::size_t>> {
+    if (key_kind != JoinKeyKind::VALUE) {
+        if (auto ordered_positions = table.get_positions_ordered_by(column_index)) return ordered_positions;
     }
-    return -1;
-}
 
-auto SelectParser::is_valid_select_join_query(int join_type_clause_index, int join_clause_index, int on_clause_index) -> bool {
-    return join_clause_index == join_type_clause_index + 1 && on_clause_index == join_clause_index + 2;
+    const auto& column = table.columns[column_index];
+    if (!is_presorted(column, std::nullopt, key_kind)) return std::nullopt;
+
+    auto positions = std::vector<std::size_t>(column.size());
+    std::iota(positions.begin(), positions.end(), std::size_t{0});
+
+    return positions;
 }
 
-auto SelectParser::validate_tables_and_columns(
-    const std::string &left,
-    const std::string &right,
-    const std::vector<std::string> &query_elements
-) const -> bool {
-    const auto from_clause_index = find_index(query_elements, "FROM");
-    const auto join_clause_index = find_index(query_elements, "JOIN");
+auto SelectParser::is_presorted(
+    const Table& table,
+    const int column_index,
+    const std::optional<std::vector<std::size_t>>& positions,
+    const JoinKeyKind key_kind
+) -> bool {
+    if (!positions && key_kind != JoinKeyKind::VALUE && table.ordered_indexes.at(column_index)) return true;
 
-    const auto [left_table_name, left_column_name] = split_string_with_dot(left);
-    const auto [right_table_name, right_column_name] = split_string_with_dot(right);
+    return is_presorted(table.columns[column_index], positions, key_kind);
+}
 
-    if (!parser.database->tables.contains(left_table_name)) {
-        fmt::println("Table with name '{}' not exists in database '{}'!", left_table_name, parser.database->name);
-        return false;
-    }
+auto SelectParser::is_presorted(
+    const Column& column,
+    const std::optional<std::vector<std::size_t>>& positions,
+    const JoinKeyKind key_kind
+) -> bool {
+    const auto row_count = positions ? positions->size() : column.size();
+    const auto position_of = [&](const std::size_t row) { return positions ? (*positions)[row] : row; };
 
-    if (!parser.database->tables.contains(right_table_name)) {
-        fmt::println("Table with name '{}' not exists in database '{}'!", right_table_name, parser.database->name);
-        return false;
+    for (auto row = std::size_t{1}; row < row_count; ++row) {
+        if (compare_join_keys(column, position_of(row - 1), column, position_of(row), key_kind) > 0) return false;
     }
 
-    if (left_table_name != query_elements.at(from_clause_index + 1)) {
-        fmt::println("Left table name after ON clause not match table name after FROM clause!");
-        return false;
-    }
+    return true;
+}
 
-    if (right_table_name != query_elements.at(join_clause_index + 1)) {
-        fmt::println("Right table name after ON clause not match table name after JOIN clause!");
-        return false;
+auto SelectParser::get_presorted_rows(const JoinInput& input, const JoinKeyKind key_kind) -> std::optional<std::vector<std::size_t>> {
+    if (input.are_table_positions) return get_presorted_positions(input.table, input.column_index, key_kind);
+
+    const auto& column = input.table.columns[input.column_index];
+    auto rows = std::vector<std::size_t>{};
+    rows.reserve(input.positions.size());
+
+    for (auto row = std::size_t{0}; row < input.positions.size(); ++row) {
+        if (!input.positions[row]) continue;
+
+        if (!rows.empty() && compare_join_keys(column, *input.positions[rows.back()], column, *input.positions[row], key_kind) > 0) {
+            return std::nullopt;
+        }
+
+        rows.push_back(row);
     }
 
-    auto left_table = parser.database->tables.find(left_table_name)->second;
-    auto right_table = parser.database->tables.find(right_table_name)->second;
+    return rows;
+}
 
-    if (std::ranges::find(left_table.column_names, left_column_name) == left_table.column_names.end()) {
-        fmt::println("'{}' column not exists in table '{}'!", left_column_name, left_table_name);
-        return false;
+auto SelectParser::sort_rows(
+    const Column& column,
+    const std::vector<std::optional<std::size_t>>& positions,
+    const JoinKeyKind key_kind
+) -> std::vector<std::size_t> {
+    auto rows = std::vector<std::size_t>{};
+    rows.reserve(positions.size());
+
+    for (auto row = std::size_t{0}; row < positions.size(); ++row) {
+        if (positions[row]) rows.push_back(row);
     }
 
-    if (std::ranges::find(right_table.column_names, right_column_name) == right_table.column_names.end()) {
-        fmt::println("'{}' column not exists in table '{}'!", right_column_name, right_table_name);
-        return false;
+    std::ranges::stable_sort(rows, [&](const std::size_t row, const std::size_t other_row) {
+        return compare_join_keys(column, *positions[row], column, *positions[other_row], key_kind) < 0;
+    });
+
+    return rows;
+}
+
+auto SelectParser::compare_join_keys(
+    const Column& column,
+    const std::size_t position,
+    const Column& other,
+    const std::size_t other_position,
+    const JoinKeyKind key_kind
+) -> int {
+    const auto compare = [](const auto& value, const auto& other_value) {
+        return value < other_value ? -1 : other_value < value ? 1 : 0;
+    };
+
+    if (key_kind == JoinKeyKind::TEXT) return compare(column.get_text(position), other.get_text(other_position));
+    if (key_kind == JoinKeyKind::VALUE) return compare(column.get_value(position), other.get_value(other_position));
+
+    if (column.is_null(position) || other.is_null(other_position)) {
+        return compare(!column.is_null(position), !other.is_null(other_position));
     }
 
-    return true;
+    if (key_kind == JoinKeyKind::INTEGER) return compare(column.get_integer(position), other.get_integer(other_position));
+
+    const auto value = column.type == ColumnType::INTEGER ? static_cast<double>(column.get_integer(position)) : column.get_float(position);
+    const auto other_value = other.type == ColumnType::INTEGER ? static_cast<double>(other.get_integer(other_position)) : other.get_float(other_position);
+
+    return compare(value, other_value);
 }
 
-auto SelectParser::split_string_with_dot(const std::string &str) -> std::pair<std::string, std::string> {
-    const auto dot_pos = str.find('.');
-    auto left = str.substr(0, dot_pos);
-    auto right = str.substr(dot_pos + 1);
+auto SelectParser::get_join_key_kind(const Column& left_column, const Column& right_column) -> JoinKeyKind {
+    const auto is_left_number = left_column.type == ColumnType::INTEGER || left_column.type == ColumnType::FLOAT;
+    const auto is_right_number = right_column.type == ColumnType::INTEGER || right_column.type == ColumnType::FLOAT;
+
+    if (left_column.type == ColumnType::INTEGER && right_column.type == ColumnType::INTEGER) return JoinKeyKind::INTEGER;
+    if (is_left_number && is_right_number) return JoinKeyKind::NUMBER;
+    if (!is_left_number && !is_right_number) return JoinKeyKind::TEXT;
 
-    return std::pair{left, right};
+    return JoinKeyKind::VALUE;
 }
 
-auto SelectParser::get_column_names_from_both(const std::vector<std::string> &table_names) const -> std::vector<std::string> {
-    auto column_names_from_both = std::vector<std::string>{};
-    for (auto& tab_name : table_names) {
-        const auto& col_names = parser.database->get_table_by_name(tab_name).column_names;
+auto SelectParser::hash_join_key(const Column& column, const std::size_t position, const JoinKeyKind key_kind) -> std::size_t {
+    if (key_kind == JoinKeyKind::TEXT) return std::hash<std::string_view>{}(column.get_text(position));
+    if (key_kind == JoinKeyKind::VALUE) return std::hash<std::string>{}(column.get_value(position));
+    if (column.is_null(position)) return 0;
+    if (key_kind == JoinKeyKind::INTEGER) return std::hash<std::int64_t>{}(column.get_integer(position));
 
-        for (const auto& col_name : col_names) {
-            column_names_from_both.push_back(tab_name + "." + col_name);
+    const auto value = column.type == ColumnType::INTEGER ? static_cast<double>(column.get_integer(position)) : column.get_float(position);
+    return std::hash<double>{}(value == 0.0 ? 0.0 : value);
+}
+
+auto SelectParser::resolve_joined_column(
+    const ColumnReference& column,
+    const std::vector<const Table*>& tables
+) -> std::optional<JoinedColumn> {
+    auto joined_column = std::optional<JoinedColumn>{};
+
+    for (auto table_index = std::size_t{0}; table_index < tables.size(); ++table_index) {
+        const auto& table = *tables[table_index];
+        if (!column.table_name.empty() && column.table_name != table.name) continue;
+
+        const auto column_index = Table::find_index(table.column_names, column.column_name);
+        if (column_index == -1) continue;
+
+        if (joined_column) {
+            fmt::println("Column with name '{}' exists in more than one joined table!", column.column_name);
+            return std::nullopt;
         }
+
+        joined_column = JoinedColumn{table_index, column_index};
     }
-    return column_names_from_both;
+
+    if (!joined_column) fmt::println("Column with name '{}' not exists in joined tables!", column.full_name());
+
+    return joined_column;
+}
+
+auto SelectParser::filter_joined_rows(
+    const std::vector<JoinedRow>& joined_rows,
+    const WhereClause& where,
+    const std::vector<std::size_t>& conjuncts,
+    const std::vector<const Table*>& tables,
+    const std::size_t max_rows
+) -> std::optional<std::vector<JoinedRow>> {
+    auto predicates = std::vector<std::pair<std::size_t, Predicate>>(where.expressions.size());
+
+    for (auto i = std::size_t{0}; i < where.expressions.size(); ++i) {
+        if (where.expressions[i].type != ExpressionType::CONDITION) continue;
+
+        const auto& condition = where.expressions[i].condition;
+        const auto joined_column = resolve_joined_column(condition.column, tables);
+        if (!joined_column) return std::nullopt;
+
+        if (!Predicate::is_valid_operator(condition.comparison_operator)) {
+            fmt::println("Invalid comparison operator: {}", condition.comparison_operator);
+            return std::nullopt;
+        }
+
+        const auto& table = *tables[joined_column->table_index];
+        predicates[i] = {
+            joined_column->table_index,
+            Predicate(table.columns[joined_column->column_index], condition.comparison_operator, condition.value)
+        };
+    }
+
+    auto filtered_rows = std::vector<JoinedRow>{};
+
+    for (const auto& joined_row : joined_rows) {
+        if (filtered_rows.size() == max_rows) break;
+
+        const auto evaluate_condition = [&](const std::size_t index) {
+            const auto& [table_index, predicate] = predicates[index];
+            const auto& position = joined_row[table_index];
+
+            return position && predicate.matches(*position);
+        };
+
+        const auto is_row_matching = std::ranges::all_of(conjuncts, [&](const std::size_t conjunct) {
+            return where.evaluate(conjunct, evaluate_condition);
+        });
+
+        if (is_row_matching) filtered_rows.push_back(joined_row);
+    }
+
+    return filtered_rows;
 }
@@ -1,6 +1,13 @@
 #pragma once
 
+#include <optional>
+
+#include "../../ast.h"
 #include "../../parser.h"
+#include "../../queryplan.h"
+#include "../../../table/aggregator.h"
+#include "../../../table/distinctfilter.h"
+#include "../../../table/rowsorter.h"
 #include "../../../enums/jointype.h"
 
 struct SelectParser {
@@ -9,84 +16,253 @@ struct SelectParser {
 
     explicit SelectParser(Parser& parser) : parser(parser) {}
 
-    auto parse_select_query(const std::vector<std::string>& query_elements) const -> void;
+    auto parse_select_query(const std::string& query) const -> void;
+
+    [[nodiscard]] auto plan_select(const SelectStatement& statement) const -> std::optional<SelectPlan>;
+
+    auto print_select(const SelectStatement& statement, const SelectPlan& plan) const -> void;
 
 private:
-    [[nodiscard]] auto get_select_inner_join_result(
-           const std::vector<std::string>& query_elements,
-           const std::vector<std::string>& column_names
-    ) const -> std::vector<std::vector<std::string>>;
-
-    [[nodiscard]] auto get_specific_columns_for_inner_join(
-        const std::string& left,
-        const std::string& right,
-        const std::vector<std::string>& column_names
-    ) const -> std::vector<std::vector<std::string>>;
-
-    [[nodiscard]] auto get_select_left_join_result(
-        const std::vector<std::string>& query_elements,
-        const std::vector<std::string>& column_names
-    ) const -> std::vector<std::vector<std::string>>;
-
-    [[nodiscard]] auto get_specific_columns_for_left_join(
-        const std::string& left,
-        const std::string& right,
-        const std::vector<std::string>& column_names
-    ) const -> std::vector<std::vector<std::string>>;
-
-    [[nodiscard]] auto get_select_right_join_result(
-        const std::vector<std::string>& query_elements,
-        const std::vector<std::string>& column_names
-    ) const -> std::vector<std::vector<std::string>>;
-
-    [[nodiscard]] auto get_specific_columns_for_right_join(
-        const std::string& left,
-        const std::string& right,
-        const std::vector<std::string>& column_names
-    ) const -> std::vector<std::vector<std::string>>;
-
-    [[nodiscard]] auto get_select_full_join_result(
-        const std::vector<std::string>& query_elements,
-        const std::vector<std::string>& column_names
-    ) const -> std::vector<std::vector<std::string>>;
-
-    [[nodiscard]] auto get_specific_columns_for_full_join(
-        const std::string& left,
-        const std::string& right,
-        const std::vector<std::string>& column_names
-    ) const -> std::vector<std::vector<std::string>>;
-
-    [[nodiscard]] auto get_all_columns_for_join(
-        const std::string& left,
-        const std::string& right,
-        const JoinType& join_type
-    ) const -> std::vector<std::vector<std::string>>;
-
-    auto print_appropriate_columns_without_joins(
-        const std::vector<std::string>& query_elements
+    enum class JoinKeyKind {
+        INTEGER,
+        NUMBER,
+        TEXT,
+        VALUE
+    };
+
+    enum class JoinAlgorithm {
+        HASH,
+        MERGE
+    };
+
+    struct JoinStep {
+        JoinType type = JoinType::INNER;
+        std::size_t table_index = 0;
+        JoinedColumn left;
+        int right_column_index = -1;
+    };
+
+    struct JoinPlan {
+        std::size_t first_table_index = 0;
+        std::vector<JoinStep> steps;
+    };
+
+    struct JoinInput {
+        const Table& table;
+        int column_index = -1;
+        std::vector<std::optional<std::size_t>> positions;
+        bool are_table_positions = false;
+    };
+
+    using JoinedRow = std::vector<std::optional<std::size_t>>;
+    using JoinMatch = std::pair<std::optional<std::size_t>, std::optional<std::size_t>>;
+
+    static constexpr std::size_t hash_join_bytes_per_row = 4 * sizeof(std::size_t);
+    static constexpr std::size_t hash_join_memory_budget = std::size_t{256} * 1024 * 1024;
+    static constexpr std::size_t distinct_values_sample_size = 1024;
+
+    auto print_select_without_join(const SelectStatement& statement, const SelectPlan& plan) const -> void;
+
+    auto print_select_with_join(const SelectStatement& statement, const SelectPlan& plan) const -> void;
+
+    auto print_select_with_aggregation(const SelectStatement& statement, const SelectPlan& plan) const -> void;
+
+    [[nodiscard]] static auto plan_aggregation(const SelectStatement& statement, SelectPlan& plan) -> bool;
+
+    [[nodiscard]] static auto is_projected(const SelectPlan& plan, const JoinedColumn& column) -> bool;
+
+    auto print_rows(const std::vector<std::vector<std::string>>& rows) const -> void;
+
+    [[nodiscard]] auto is_plan_only() const -> bool;
+
+    auto record_planned_stages(
+        const SelectStatement& statement,
+        const SelectPlan& plan,
+        std::size_t row_count,
+        std::size_t column_count
     ) const -> void;
 
-    auto print_appropriate_columns_with_joins(
-        const std::vector<std::string>& query_elements,
-        const std::vector<std::string>& column_names
+    [[nodiscard]] static auto get_rows_bytes(const std::vector<std::vector<std::string>>& rows) -> std::size_t;
+
+    [[nodiscard]] static auto get_joined_rows_bytes(const std::vector<JoinedRow>& joined_rows) -> std::size_t;
+
+    [[nodiscard]] static auto get_join_step_bytes(
+        const JoinInput& left,
+        const JoinInput& right,
+        const std::vector<JoinMatch>& matches,
+        JoinAlgorithm join_algorithm
+    ) -> std::size_t;
+
+    [[nodiscard]] static auto describe_sort(const SelectStatement& statement, const SelectPlan& plan, std::size_t row_count) -> std::string;
+
+    [[nodiscard]] static auto describe_output(const SelectStatement& statement, std::size_t column_count) -> std::string;
+
+    [[nodiscard]] static auto describe_aggregate(const SelectStatement& statement) -> std::string;
+
+    [[nodiscard]] static auto describe_joined_filter(const WhereClause& where, const std::vector<std::size_t>& conjuncts) -> std::string;
+
+    [[nodiscard]] static auto describe_join_step(
+        const JoinStep& step,
+        const std::vector<const Table*>& tables,
+        JoinAlgorithm join_algorithm
+    ) -> std::string;
+
+    [[nodiscard]] static auto can_use_summaries(const SelectStatement& statement, const SelectPlan& plan) -> bool;
+
+    [[nodiscard]] static auto get_summary_row(const SelectPlan& plan) -> std::vector<std::string>;
+
+    [[nodiscard]] auto get_filtered_joined_rows(
+        const SelectStatement& statement,
+        const SelectPlan& plan,
+        std::size_t max_rows
+    ) const -> std::optional<std::vector<JoinedRow>>;
+
+    [[nodiscard]] static auto resolve_projection(const SelectStatement& statement, const Table& table) -> std::vector<int>;
+
+    static auto filter_distinct_positions(
+        std::vector<std::size_t>& positions,
+        const Table& table,
+        const std::vector<int>& column_indices,
+        std::size_t max_rows
+    ) -> void;
+
+    static auto filter_distinct_rows(
+        std::vector<std::size_t>& rows,
+        const std::vector<JoinedRow>& joined_rows,
+        const std::vector<JoinedColumn>& joined_columns,
+        const std::vector<const Table*>& tables,
+        std::size_t max_rows
+    ) -> void;
+
+    [[nodiscard]] static auto hash_value(const Column& column, std::optional<std::size_t> position) -> std::size_t;
+
+    [[nodiscard]] static auto resolve_order_keys(
+        const SelectStatement& statement,
+        const std::vector<const Table*>& tables
+    ) -> std::optional<std::vector<OrderKey>>;
+
+    [[nodiscard]] static auto get_row_sorter(const SelectPlan& plan) -> RowSorter;
+
+    [[nodiscard]] auto get_joined_tables(const SelectStatement& statement) const -> std::optional<std::vector<const Table*>>;
+
+    [[nodiscard]] static auto plan_joins(
+        const SelectStatement& statement,
+        const std::vector<const Table*>& tables,
+        const std::vector<std::size_t>& row_counts
+    ) -> std::optional<JoinPlan>;
+
+    [[nodiscard]] static auto reorder_inner_joins(
+        const std::vector<JoinStep>& steps,
+        const std::vector<const Table*>& tables,
+        const std::vector<std::size_t>& row_counts
+    ) -> JoinPlan;
+
+    [[nodiscard]] static auto estimate_joined_rows(
+        const JoinStep& step,
+        const std::vector<const Table*>& tables,
+        const std::vector<std::size_t>& row_counts,
+        double left_rows
+    ) -> double;
+
+    [[nodiscard]] static auto estimate_distinct_values(const Table& table, int column_index) -> std::size_t;
+
+    [[nodiscard]] static auto push_down_conjuncts(
+        const WhereClause& where,
+        const std::vector<const Table*>& tables,
+        const std::vector<JoinClause>& joins
+    ) -> std::optional<std::vector<std::optional<std::size_t>>>;
+
+    [[nodiscard]] auto get_joined_rows(
+        const JoinPlan& plan,
+        const std::vector<const Table*>& tables,
+        const std::vector<std::optional<std::vector<std::size_t>>>& table_positions,
+        std::size_t max_rows
+    ) const -> std::vector<JoinedRow>;
+
+    auto record_join_plan(
+        const JoinPlan& plan,
+        const std::vector<const Table*>& tables,
+        const std::vector<std::optional<std::vector<std::size_t>>>& table_positions,
+        const std::vector<std::size_t>& row_counts
     ) const -> void;
 
-    static auto find_index(const std::vector<std::string>& vec, const std::string& value) -> int;
+    [[nodiscard]] static auto choose_join_algorithm(bool are_presorted, std::size_t build_size) -> JoinAlgorithm;
+
+    [[nodiscard]] static auto get_join_matches(
+        const JoinInput& left,
+        const JoinInput& right,
+        JoinType join_type,
+        std::size_t max_matches,
+        JoinAlgorithm& join_algorithm
+    ) -> std::vector<JoinMatch>;
+
+    [[nodiscard]] static auto get_hash_join_matches(
+        const JoinInput& left,
+        const JoinInput& right,
+        JoinKeyKind key_kind,
+        JoinType join_type,
+        std::size_t max_matches
+    ) -> std::vector<JoinMatch>;
 
-    static auto is_valid_select_join_query(
-        int join_type_clause_index,
-        int join_clause_index,
-        int on_clause_index
+    [[nodiscard]] static auto get_merge_join_matches(
+        const JoinInput& left,
+        const std::vector<std::size_t>& left_order,
+        const JoinInput& right,
+        const std::vector<std::size_t>& right_order,
+        JoinKeyKind key_kind,
+        JoinType join_type,
+        std::size_t max_matches
+    ) -> std::vector<JoinMatch>;
+
+    [[nodiscard]] static auto is_presorted(
+        const Table& table,
+        int column_index,
+        const std::optional<std::vector<std::size_t>>& positions,
+        JoinKeyKind key_kind
     ) -> bool;
 
-    [[nodiscard]] auto validate_tables_and_columns(
-        const std::string& left,
-        const std::string& right,
-        const std::vector<std::string>& query_elements
-    ) const -> bool;
+    [[nodiscard]] static auto is_presorted(
+        const Column& column,
+        const std::optional<std::vector<std::size_t>>& positions,
+        JoinKeyKind key_kind
+    ) -> bool;
 
-    static auto split_string_with_dot(const std::string& str) -> std::pair<std::string, std::string>;
+    [[nodiscard]] static auto get_presorted_rows(const JoinInput& input, JoinKeyKind key_kind) -> std::optional<std::vector<std::size_t>>;
 
-    [[nodiscard]] auto get_column_names_from_both(const std::vector<std::string>& table_names) const -> std::vector<std::string>;
-};
+    [[nodiscard]] static auto get_presorted_positions(
+        const Table& table,
+        int column_index,
+        JoinKeyKind key_kind
+    ) -> std::optional<std::vector<std::size_t>>;
 
+    [[nodiscard]] static auto sort_rows(
+        const Column& column,
+        const std::vector<std::optional<std::size_t>>& positions,
+        JoinKeyKind key_kind
+    ) -> std::vector<std::size_t>;
+
+    [[nodiscard]] static auto compare_join_keys(
+        const Column& column,
+        std::size_t position,
+        const Column& other,
+        std::size_t other_position,
+        JoinKeyKind key_kind
+    ) -> int;
+
+    [[nodiscard]] static auto get_join_key_kind(const Column& left_column, const Column& right_column) -> JoinKeyKind;
+
+    [[nodiscard]] static auto hash_join_key(const Column& column, std::size_t position, JoinKeyKind key_kind) -> std::size_t;
+
+    [[nodiscard]] static auto resolve_joined_column(
+        const ColumnReference& column,
+        const std::vector<const Table*>& tables
+    ) -> std::optional<JoinedColumn>;
+
+    [[nodiscard]] static auto filter_joined_rows(
+        const std::vector<JoinedRow>& joined_rows,
+        const WhereClause& where,
+        const std::vector<std::size_t>& conjuncts,
+        const std::vector<const Table*>& tables,
+        std::size_t max_rows
+    ) -> std::optional<std::vector<JoinedRow>>;
+};
@@ -1,384 +1,184 @@
 #include "whereclauseparser.h"
 
-auto WhereClauseParser::get_data_filtered_by_equality(
-    const std::vector<std::string> &table_names,
-    const std::vector<std::string> &column_names,
-    const std::string &condition_column_name,
-    const std::string &condition_column_value,
-    const bool is_select_with_join,
-    const std::vector<std::vector<std::string>>& select_results
-) const -> std::vector<std::vector<std::string>> {
-    const auto database = parser.database;
-    auto flattened_results = std::vector<std::vector<std::string>>{};
-
-    for (auto table_name : table_names) {
-        std::erase(table_name, ',');
-
-        auto filtered_data = std::vector<std::vector<std::string>>{};
-
-        if (is_select_with_join) {
-            auto effective_column_names = column_names.at(0) == "*" && column_names.size() == 1 ?
-                get_column_names_from_both(table_names) :
-                column_names;
-
-            if (!database->tables.contains(table_name)) continue;
-
-            filtered_data = parser.database->get_table_by_name(table_name).get_data_filtered_by(
-                    "=",
-                    select_results,
-                    effective_column_names,
-                    condition_column_name,
-                    condition_column_value);
-            for (const auto& data : filtered_data) {
-                if (std::ranges::find(flattened_results, data) == flattened_results.end()) flattened_results.push_back(data);
-            }
-
-            continue;
-        }
+#include <numeric>
 
-        if (!database->tables.contains(table_name)) continue;
-
-        filtered_data = database->tables.find(table_name)->second.get_all_data_from(
-            column_names, parser.database->get_table_by_name(table_name).get_data_filtered_by(
-                "=",
-                database->tables.find(table_name)->second.get_all_data(),
-                database->tables.find(table_name)->second.column_names,
-                condition_column_name,
-                condition_column_value)
-        );
-        flattened_results.insert(flattened_results.end(), filtered_data.begin(), filtered_data.end());
-    }
+#include "../../astparser.h"
 
-    return flattened_results;
+auto WhereClauseParser::get_positions_filtered_by(
+    const Table& table,
+    const WhereClause& where
+) const -> std::vector<std::size_t> {
+    return get_positions_filtered_by(table, where, {where.root});
 }
 
-auto WhereClauseParser::get_data_filtered_by_inequality(
-    const std::vector<std::string> &table_names,
-    const std::vector<std::string> &column_names,
-    const std::string &condition_column_name,
-    const std::string &condition_column_value,
-    const bool is_select_with_join,
-    const std::vector<std::vector<std::string>>& select_results
-) const -> std::vector<std::vector<std::string> > {
-    const auto database = parser.database;
-    auto flattened_results = std::vector<std::vector<std::string>>{};
-
-    for (auto table_name : table_names) {
-        std::erase(table_name, ',');
-
-        auto filtered_data = std::vector<std::vector<std::string>>{};
-
-        if (is_select_with_join) {
-            auto effective_column_names = column_names.at(0) == "*" && column_names.size() == 1 ?
-                get_column_names_from_both(table_names) :
-                column_names;
-
-            if (!database->tables.contains(table_name)) continue;
-
-            filtered_data = parser.database->get_table_by_name(table_name).get_data_filtered_by(
-                    "!=",
-                    select_results,
-                    effective_column_names,
-                    condition_column_name,
-                    condition_column_value);
-
-            for (const auto& data : filtered_data) {
-                if (std::ranges::find(flattened_results, data) == flattened_results.end()) flattened_results.push_back(data);
-            }
-
-            continue;
-        }
+auto WhereClauseParser::get_positions_filtered_by(
+    const Table& table,
+    const WhereClause& where,
+    const std::vector<std::size_t>& conjuncts
+) const -> std::vector<std::size_t> {
+    const auto start = QueryProfiler::checkpoint();
+    const auto predicates = compile_predicates(table, where);
+    if (!predicates || conjuncts.empty()) return {};
 
-        if (!database->tables.contains(table_name)) continue;
-
-        filtered_data = database->tables.find(table_name)->second.get_all_data_from(
-            column_names, parser.database->get_table_by_name(table_name).get_data_filtered_by(
-                "!=",
-                database->tables.find(table_name)->second.get_all_data(),
-                column_names,
-                condition_column_name,
-                condition_column_value)
-        );
-        flattened_results.insert(flattened_results.end(), filtered_data.begin(), filtered_data.end());
+    auto positions = filter_positions(table, where, *predicates, conjuncts.front(), nullptr);
+
+    for (auto i = std::size_t{1}; i < conjuncts.size() && !positions.empty(); ++i) {
+        positions = filter_positions(table, where, *predicates, conjuncts[i], &positions);
     }
 
-    return flattened_results;
+    if (parser.profiler) {
+        parser.profiler->record(
+            describe_filter(table, where, conjuncts),
+            table.row_count(), positions.size(), positions.capacity() * sizeof(std::size_t), start);
+    }
+
+    return positions;
 }
 
-auto WhereClauseParser::get_data_filtered_by_greater_than(
-    const std::vector<std::string> &table_names,
-    const std::vector<std::string> &column_names,
-    const std::string &condition_column_name,
-    const std::string &condition_column_value,
-    const bool is_select_with_join,
-    const std::vector<std::vector<std::string>>& select_results
-) const -> std::vector<std::vector<std::string> > {
-    const auto database = parser.database;
-    auto flattened_results = std::vector<std::vector<std::string>>{};
-
-    for (auto table_name : table_names) {
-        std::erase(table_name, ',');
-
-        auto filtered_data = std::vector<std::vector<std::string>>{};
-
-        if (is_select_with_join) {
-            auto effective_column_names = column_names.at(0) == "*" && column_names.size() == 1 ?
-                get_column_names_from_both(table_names) :
-                column_names;
-
-            if (!database->tables.contains(table_name)) continue;
-
-            filtered_data = parser.database->get_table_by_name(table_name).get_data_filtered_by(
-                    ">",
-                    select_results,
-                    effective_column_names,
-                    condition_column_name,
-                    condition_column_value);
-
-            for (const auto& data : filtered_data) {
-                if (std::ranges::find(flattened_results, data) == flattened_results.end()) flattened_results.push_back(data);
-            }
-
-            continue;
-        }
+auto WhereClauseParser::get_first_positions_filtered_by(
+    const Table& table,
+    const WhereClause& where,
+    const std::size_t limit
+) const -> std::vector<std::size_t> {
+    const auto& root = where.expressions[where.root];
 
-        if (!database->tables.contains(table_name)) continue;
-
-        filtered_data = database->tables.find(table_name)->second.get_all_data_from(
-            column_names, parser.database->get_table_by_name(table_name).get_data_filtered_by(
-                ">",
-                database->tables.find(table_name)->second.get_all_data(),
-                column_names,
-                condition_column_name,
-                condition_column_value)
-        );
-        flattened_results.insert(flattened_results.end(), filtered_data.begin(), filtered_data.end());
+    if (root.type == ExpressionType::CONDITION && table.is_indexed(root.condition.column.full_name())) {
+        auto positions = get_positions_filtered_by(table, where);
+        if (positions.size() > limit) positions.resize(limit);
+
+        return positions;
     }
 
-    return flattened_results;
-}
+    const auto start = QueryProfiler::checkpoint();
+    const auto predicates = compile_predicates(table, where);
+    if (!predicates) return {};
 
-auto WhereClauseParser::get_data_filtered_by_greater_than_or_equal(
-    const std::vector<std::string> &table_names,
-    const std::vector<std::string> &column_names,
-    const std::string &condition_column_name,
-    const std::string &condition_column_value,
-    const bool is_select_with_join,
-    const std::vector<std::vector<std::string>>& select_results
-) const -> std::vector<std::vector<std::string> > {
-    const auto database = parser.database;
-    auto flattened_results = std::vector<std::vector<std::string>>{};
-
-    for (auto table_name : table_names) {
-        std::erase(table_name, ',');
-
-        auto filtered_data = std::vector<std::vector<std::string>>{};
-
-        if (is_select_with_join) {
-            auto effective_column_names = column_names.at(0) == "*" && column_names.size() == 1 ?
-                get_column_names_from_both(table_names) :
-                column_names;
-
-            if (!database->tables.contains(table_name)) continue;
-
-            filtered_data = parser.database->get_table_by_name(table_name).get_data_filtered_by(
-                    ">=",
-                    select_results,
-                    effective_column_names,
-                    condition_column_name,
-                    condition_column_value);
-
-            for (const auto& data : filtered_data) {
-                if (std::ranges::find(flattened_results, data) == flattened_results.end()) flattened_results.push_back(data);
-            }
-
-            continue;
-        }
+    auto positions = std::vector<std::size_t>{};
+    auto chunk = std::vector<std::size_t>{};
+    auto scanned_rows = std::size_t{0};
+
+    for (auto begin = std::size_t{0}; begin < table.row_count() && positions.size() < limit; begin += limited_scan_chunk_size) {
+        chunk.resize(std::min(limited_scan_chunk_size, table.row_count() - begin));
+        std::iota(chunk.begin(), chunk.end(), begin);
 
-        if (!database->tables.contains(table_name)) continue;
-
-        filtered_data = database->tables.find(table_name)->second.get_all_data_from(
-            column_names, parser.database->get_table_by_name(table_name).get_data_filtered_by(
-                ">=",
-                database->tables.find(table_name)->second.get_all_data(),
-                column_names,
-                condition_column_name,
-                condition_column_value)
-        );
-        flattened_results.insert(flattened_results.end(), filtered_data.begin(), filtered_data.end());
+        const auto chunk_positions = filter_positions(table, where, *predicates, where.root, &chunk);
+        positions.insert(positions.end(), chunk_positions.begin(), chunk_positions.end());
+        scanned_rows += chunk.size();
     }
 
-    return flattened_results;
-}
+    if (positions.size() > limit) positions.resize(limit);
 
-auto WhereClauseParser::get_data_filtered_by_less_than(
-    const std::vector<std::string> &table_names,
-    const std::vector<std::string> &column_names,
-    const std::string &condition_column_name,
-    const std::string &condition_column_value,
-    const bool is_select_with_join,
-    const std::vector<std::vector<std::string>>& select_results
-) const -> std::vector<std::vector<std::string> > {
-    const auto database = parser.database;
-    auto flattened_results = std::vector<std::vector<std::string>>{};
-
-    for (auto table_name : table_names) {
-        std::erase(table_name, ',');
-
-        auto filtered_data = std::vector<std::vector<std::string>>{};
-
-        if (is_select_with_join) {
-            auto effective_column_names = column_names.at(0) == "*" && column_names.size() == 1 ?
-                get_column_names_from_both(table_names) :
-                column_names;
-
-            if (!database->tables.contains(table_name)) continue;
-
-            filtered_data = parser.database->get_table_by_name(table_name).get_data_filtered_by(
-                    "<",
-                    select_results,
-                    effective_column_names,
-                    condition_column_name,
-                    condition_column_value);
-
-            for (const auto& data : filtered_data) {
-                if (std::ranges::find(flattened_results, data) == flattened_results.end()) flattened_results.push_back(data);
-            }
-
-            continue;
-        }
+    if (parser.profiler) {
+        parser.profiler->record(
+            fmt::format("Limited scan of '{}' in chunks of {} rows, stopping after {} rows: {}", table.name, limited_scan_chunk_size, limit, where.to_string(where.root)),
+            scanned_rows, positions.size(), (positions.capacity() + chunk.capacity()) * sizeof(std::size_t), start);
+    }
 
-        if (!database->tables.contains(table_name)) continue;
-
-        filtered_data = database->tables.find(table_name)->second.get_all_data_from(
-            column_names, parser.database->get_table_by_name(table_name).get_data_filtered_by(
-                "<",
-                database->tables.find(table_name)->second.get_all_data(),
-                column_names,
-                condition_column_name,
-                condition_column_value)
-        );
-        flattened_results.insert(flattened_results.end(), filtered_data.begin(), filtered_data.end());
+    return positions;
+}
+
+auto WhereClauseParser::get_row_ids_filtered_by(
+    const std::string& table_name,
+    const std::vector<std::string>& query_elements,
+    const int where_clause_index
+) const -> std::vector<std::size_t> {
+    const auto& table = parser.database->get_table_by_name(table_name);
+    auto where_clause = std::string{};
+
+    for (auto it = query_elements.begin() + where_clause_index + 1; it < query_elements.end(); ++it) {
+        if (!where_clause.empty()) where_clause += ' ';
+        where_clause += *it;
     }
 
-    return flattened_results;
+    auto tokens = Lexer(where_clause).tokenize();
+    if (!tokens) return {};
+
+    const auto where = AstParser(std::move(*tokens)).parse_where();
+    if (!where) return {};
+
+    auto specific_row_ids = get_positions_filtered_by(table, *where);
+    for (auto& position : specific_row_ids) position = table.row_ids[position];
+
+    return specific_row_ids;
 }
 
-auto WhereClauseParser::get_data_filtered_by_less_than_or_equal(
-    const std::vector<std::string> &table_names,
-    const std::vector<std::string> &column_names,
-    const std::string &condition_column_name,
-    const std::string &condition_column_value,
-    const bool is_select_with_join,
-    const std::vector<std::vector<std::string>>& select_results
-) const -> std::vector<std::vector<std::string> > {
-    const auto database = parser.database;
-    auto flattened_results = std::vector<std::vector<std::string>>{};
-
-    for (auto table_name : table_names) {
-        std::erase(table_name, ',');
-
-        auto filtered_data = std::vector<std::vector<std::string>>{};
-
-        if (is_select_with_join) {
-            auto effective_column_names = column_names.at(0) == "*" && column_names.size() == 1 ?
-                get_column_names_from_both(table_names) :
-                column_names;
-
-            if (!database->tables.contains(table_name)) continue;
-
-            filtered_data = parser.database->get_table_by_name(table_name).get_data_filtered_by(
-                    "<=",
-                    select_results,
-                    effective_column_names,
-                    condition_column_name,
-                    condition_column_value);
-
-            for (const auto& data : filtered_data) {
-                if (std::ranges::find(flattened_results, data) == flattened_results.end()) flattened_results.push_back(data);
-            }
-
-            continue;
-        }
+auto WhereClauseParser::describe_filter(
+    const Table& table,
+    const WhereClause& where,
+    const std::vector<std::size_t>& conjuncts
+) -> std::string {
+    auto index = conjuncts.front();
+    while (where.expressions[index].type != ExpressionType::CONDITION) index = where.expressions[index].left;
 
-        if (!database->tables.contains(table_name)) continue;
-
-        filtered_data = database->tables.find(table_name)->second.get_all_data_from(
-            column_names, parser.database->get_table_by_name(table_name).get_data_filtered_by(
-                "<=",
-                database->tables.find(table_name)->second.get_all_data(),
-                column_names,
-                condition_column_name,
-                condition_column_value)
-        );
-        flattened_results.insert(flattened_results.end(), filtered_data.begin(), filtered_data.end());
-    }
+    const auto& condition = where.expressions[index].condition;
+    const auto access_path = table.get_access_path(condition.comparison_operator, condition.column.full_name(), condition.value);
+
+    auto conditions = std::vector<std::string>{};
+    for (const auto conjunct : conjuncts) conditions.push_back(where.to_string(conjunct));
+
+    if (access_path == AccessPath::FULL_SCAN) return fmt::format("Filter '{}' using full scan: {}", table.name, fmt::join(conditions, " AND "));
 
-    return flattened_results;
+    return fmt::format(
+        "Filter '{}' using {} on '{}': {}",
+        table.name, access_path_to_string(access_path), condition.column.column_name, fmt::join(conditions, " AND "));
 }
 
-auto WhereClauseParser::get_data_filtered_by_like(
-    const std::vector<std::string> &table_names,
-    const std::vector<std::string> &column_names,
-    const std::string &condition_column_name,
-    const std::string &condition_column_value,
-    const bool is_select_with_join,
-    const std::vector<std::vector<std::string>>& select_results
-) const -> std::vector<std::vector<std::string> > {
-    const auto database = parser.database;
-    auto flattened_results = std::vector<std::vector<std::string>>{};
-
-    for (auto table_name : table_names) {
-        std::erase(table_name, ',');
-
-        auto filtered_data = std::vector<std::vector<std::string>>{};
-
-        if (is_select_with_join) {
-            auto effective_column_names = column_names.at(0) == "*" && column_names.size() == 1 ?
-                get_column_names_from_both(table_names) :
-                column_names;
-
-            if (!database->tables.contains(table_name)) continue;
-
-            filtered_data = parser.database->get_table_by_name(table_name).get_data_filtered_by(
-                    "LIKE",
-                    select_results,
-                    effective_column_names,
-                    condition_column_name,
-                    condition_column_value);
-
-            for (const auto& data : filtered_data) {
-                if (std::ranges::find(flattened_results, data) == flattened_results.end()) flattened_results.push_back(data);
-            }
-
-            continue;
+auto WhereClauseParser::compile_predicates(
+    const Table& table,
+    const WhereClause& where
+) -> std::optional<std::vector<Predicate>> {
+    auto predicates = std::vector<Predicate>(where.expressions.size());
+
+    for (auto i = std::size_t{0}; i < where.expressions.size(); ++i) {
+        if (where.expressions[i].type != ExpressionType::CONDITION) continue;
+
+        const auto& condition = where.expressions[i].condition;
+
+        if (!Predicate::is_valid_operator(condition.comparison_operator)) {
+            fmt::println("Invalid comparison operator: {}", condition.comparison_operator);
+            return std::nullopt;
         }
 
-        if (!database->tables.contains(table_name)) continue;
-
-        filtered_data = database->tables.find(table_name)->second.get_all_data_from(
-            column_names, parser.database->get_table_by_name(table_name).get_data_filtered_by(
-                "LIKE",
-                database->tables.find(table_name)->second.get_all_data(),
-                column_names,
-                condition_column_name,
-                condition_column_value)
-        );
-        flattened_results.insert(flattened_results.end(), filtered_data.begin(), filtered_data.end());
+        predicates[i] = table.get_predicate(condition.comparison_operator, condition.column.full_name(), condition.value);
     }
 
-    return flattened_results;
+    return predicates;
 }
 
+auto WhereClauseParser::filter_positions(
+    const Table& table,
+    const WhereClause& where,
+    const std::vector<Predicate>& predicates,
+    const std::size_t index,
+    const std::vector<std::size_t>* candidates
+) -> std::vector<std::size_t> {
+    const auto& expression = where.expressions[index];
 
-auto WhereClauseParser::get_column_names_from_both(const std::vector<std::string> &table_names) const -> std::vector<std::string> {
-    auto column_names_from_both = std::vector<std::string>{};
-    for (auto& tab_name : table_names) {
-        const auto& col_names = parser.database->get_table_by_name(tab_name).column_names;
+    if (expression.type == ExpressionType::CONDITION) {
+        if (candidates) return predicates[index].filter(*candidates);
 
-        for (const auto& col_name : col_names) {
-            column_names_from_both.push_back(tab_name + "." + col_name);
-        }
+        const auto& condition = expression.condition;
+        return table.get_positions_filtered_by(condition.comparison_operator, condition.column.full_name(), condition.value);
     }
-    return column_names_from_both;
-}
\ No newline at end of file
+
+    auto left_positions = filter_positions(table, where, predicates, expression.left, candidates);
+
+    if (expression.type == ExpressionType::AND) {
+        if (left_positions.empty()) return left_positions;
+
+        return filter_positions(table, where, predicates, expression.right, &left_positions);
+    }
+
+    auto remaining_positions = std::vector<std::size_t>{};
+    if (candidates) std::ranges::set_difference(*candidates, left_positions, std::back_inserter(remaining_positions));
+    else std::ranges::set_difference(table.positions(), left_positions, std::back_inserter(remaining_positions));
+
+    if (remaining_positions.empty()) return left_positions;
+
+    const auto right_positions = filter_positions(table, where, predicates, expression.right, &remaining_positions);
+    auto positions = std::vector<std::size_t>{};
+    positions.reserve(left_positions.size() + right_positions.size());
+    std::ranges::merge(left_positions, right_positions, std::back_inserter(positions));
+
+    return positions;
+}
@@ -1,8 +1,10 @@
 #pragma once
 
+#include <optional>
 #include <string>
 #include <vector>
 
+#include "../../ast.h"
 #include "../../parser.h"
 
 struct WhereClauseParser {
@@ -11,71 +13,45 @@ struct WhereClauseParser {
 
     explicit WhereClauseParser(Parser& parser) : parser(parser) {}
 
-    [[nodiscard]] auto get_data_filtered_by_equality(
-        const std::vector<std::string>& table_names,
-        const std::vector<std::string>& column_names,
-        const std::string& condition_column_name,
-        const std::string& condition_column_value,
-        bool is_select_with_join,
-        const std::vector<std::vector<std::string>>& select_results
-    ) const -> std::vector<std::vector<std::string>>;
-
-    [[nodiscard]] auto get_data_filtered_by_inequality(
-        const std::vector<std::string>& table_names,
-        const std::vector<std::string>& column_names,
-        const std::string& condition_column_name,
-        const std::string& condition_column_value,
-        bool is_select_with_join,
-        const std::vector<std::vector<std::string>>& select_results
-    ) const -> std::vector<std::vector<std::string>>;
-
-    [[nodiscard]] auto get_data_filtered_by_greater_than(
-        const std::vector<std::string>& table_names,
-        const std::vector<std::string>& column_names,
-        const std::string& condition_column_name,
-        const std::string& condition_column_value,
-        bool is_select_with_join,
-        const std::vector<std::vector<std::string>>& select_results
-    ) const -> std::vector<std::vector<std::string>>;
-
-    [[nodiscard]] auto get_data_filtered_by_greater_than_or_equal(
-        const std::vector<std::string>& table_names,
-        const std::vector<std::string>& column_names,
-        const std::string& condition_column_name,
-        const std::string& condition_column_value,
-        bool is_select_with_join,
-        const std::vector<std::vector<std::string>>& select_results
-    ) const -> std::vector<std::vector<std::string>>;
-
-    [[nodiscard]] auto get_data_filtered_by_less_than(
-        const std::vector<std::string>& table_names,
-        const std::vector<std::string>& column_names,
-        const std::string& condition_column_name,
-        const std::string& condition_column_value,
-        bool is_select_with_join,
-        const std::vector<std::vector<std::string>>& select_results
-    ) const -> std::vector<std::vector<std::string>>;
-
-    [[nodiscard]] auto get_data_filtered_by_less_than_or_equal(
-        const std::vector<std::string>& table_names,
-        const std::vector<std::string>& column_names,
-        const std::string& condition_column_name,
-        const std::string& condition_column_value,
-        bool is_select_with_join,
-        const std::vector<std::vector<std::string>>& select_results
-    ) const -> std::vector<std::vector<std::string>>;
-
-    [[nodiscard]] auto get_data_filtered_by_like(
-        const std::vector<std::string>& table_names,
-        const std::vector<std::string>& column_names,
-        const std::string& condition_column_name,
-        const std::string& condition_column_value,
-        bool is_select_with_join,
-        const std::vector<std::vector<std::string>>& select_results
-    ) const -> std::vector<std::vector<std::string>>;
+    [[nodiscard]] auto get_positions_filtered_by(
+        const Table& table,
+        const WhereClause& where
+    ) const -> std::vector<std::size_t>;
+
+    [[nodiscard]] auto get_positions_filtered_by(
+        const Table& table,
+        const WhereClause& where,
+        const std::vector<std::size_t>& conjuncts
+    ) const -> std::vector<std::size_t>;
+
+    [[nodiscard]] auto get_first_positions_filtered_by(
+        const Table& table,
+        const WhereClause& where,
+        std::size_t limit
+    ) const -> std::vector<std::size_t>;
+
+    [[nodiscard]] auto get_row_ids_filtered_by(
+        const std::string& table_name,
+        const std::vector<std::string>& query_elements,
+        int where_clause_index
+    ) const -> std::vector<std::size_t>;
 
 private:
-    [[nodiscard]] auto get_column_names_from_both(
-        const std::vector<std::string>& table_names
-    ) const -> std::vector<std::string>;
+    static constexpr std::size_t limited_scan_chunk_size = 4096;
+
+    static auto describe_filter(
+        const Table& table,
+        const WhereClause& where,
+        const std::vector<std::size_t>& conjuncts
+    ) -> std::string;
+
+    static auto compile_predicates(const Table& table, const WhereClause& where) -> std::optional<std::vector<Predicate>>;
+
+    static auto filter_positions(
+        const Table& table,
+        const WhereClause& where,
+        const std::vector<Predicate>& predicates,
+        std::size_t index,
+        const std::vector<std::size_t>* candidates
+    ) -> std::vector<std::size_t>;
 };
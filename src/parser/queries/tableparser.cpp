@@ -86,6 +86,41 @@ auto TableParser::parse_table_query(const std::vector<std::string> &query_elemen
             }
 
             parser.database->drop_table(table_to_drop_name);
+            parser.invalidate_prepared_plans();
+        } else if (query_elements.at(1) == "INDEX") {
+            if (query_elements.size() != 5) {
+                fmt::println("Query with TABLE INDEX clauses should contain operation, table name and column name!");
+                return;
+            }
+
+            const auto& table_name = query_elements.at(3);
+            const auto& column_name = query_elements.at(4);
+
+            if (!parser.database->tables.contains(table_name)) {
+                fmt::println("Table with name '{}' does not exist in database with name: '{}'!", table_name, parser.database->name);
+                return;
+            }
+
+            if (query_elements.at(2) == "CREATE") parser.database->get_table_by_name(table_name).create_ordered_index(column_name);
+            else if (query_elements.at(2) == "DROP") parser.database->get_table_by_name(table_name).drop_ordered_index(column_name);
+            else fmt::println("Query with TABLE INDEX clauses should contain CREATE or DROP operation!");
+        } else if (query_elements.at(1) == "DICTIONARY") {
+            if (query_elements.size() != 5) {
+                fmt::println("Query with TABLE DICTIONARY clauses should contain operation, table name and column name!");
+                return;
+            }
+
+            const auto& table_name = query_elements.at(3);
+            const auto& column_name = query_elements.at(4);
+
+            if (!parser.database->tables.contains(table_name)) {
+                fmt::println("Table with name '{}' does not exist in database with name: '{}'!", table_name, parser.database->name);
+                return;
+            }
+
+            if (query_elements.at(2) == "CREATE") parser.database->get_table_by_name(table_name).create_dictionary(column_name);
+            else if (query_elements.at(2) == "DROP") parser.database->get_table_by_name(table_name).drop_dictionary(column_name);
+            else fmt::println("Query with TABLE DICTIONARY clauses should contain CREATE or DROP operation!");
         } else fmt::println("Query with TABLE clause should contain correct operation clause after TABLE clause!");
 }
 
@@ -107,7 +142,7 @@ auto TableParser::is_foreign_key_valid(
         return false;
     }
 
-    const auto foreign_table = parser.database->tables.at(foreign_table_name);
+    const auto& foreign_table = parser.database->tables.at(foreign_table_name);
     const auto column_found_in_foreign_table = std::ranges::find(foreign_table.column_names, foreign_column_name);
 
     if (column_found_in_foreign_table == foreign_table.column_names.end()) {
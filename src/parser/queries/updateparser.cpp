@@ -37,117 +37,48 @@ auto UpdateParser::parse_update_query(const std::vector<std::string> &query_elem
         columns_and_new_values.push_back({column_name, equality_operator, new_value});
     }
 
-    if (where_clause_index == -1) {
-        for (auto column_and_new_value : columns_and_new_values) {
-            parser.database->get_table_by_name(table_name).update_all_rows(
-                column_and_new_value.at(0), column_and_new_value.at(2));
-        }
-        return;
-    }
+    auto column_names = std::vector<std::string>{};
+    for (const auto& column_and_new_value : columns_and_new_values) column_names.push_back(column_and_new_value.at(0));
 
-    auto results_and_comparison_operators = std::vector<std::vector<std::vector<std::string>>>{};
-    for (auto it = query_elements.begin() + where_clause_index + 1; it + 2 < query_elements.end(); it += 4) {
-        const auto& condition_column_name = *it;
-        const auto& comparison_operator = *(it + 1);
-        const auto& condition_column_value = *(it + 2);
-
-        if (comparison_operator == "=") {
-            results_and_comparison_operators.push_back(
-                where_clause_parser.get_data_filtered_by_equality(
-                    {table_name}, {"*"}, condition_column_name, condition_column_value, false, {}));
-        }
-
-        if (comparison_operator == "<>" || comparison_operator == "!=") {
-            results_and_comparison_operators.push_back(
-                where_clause_parser.get_data_filtered_by_inequality(
-                    {table_name}, {"*"}, condition_column_name, condition_column_value, false, {}));
-        }
+    if (where_clause_index == -1) {
+        const auto description = fmt::format("Update {} of all rows of '{}'", fmt::join(column_names, ", "), table_name);
 
-        if (comparison_operator == ">") {
-            results_and_comparison_operators.push_back(
-                where_clause_parser.get_data_filtered_by_greater_than(
-                    {table_name}, {"*"}, condition_column_name, condition_column_value, false, {}));
+        if (parser.profiler && !parser.profiler->is_analyze) {
+            parser.profiler->record(description);
+            return;
         }
 
-        if (comparison_operator == ">=") {
-            results_and_comparison_operators.push_back(
-                where_clause_parser.get_data_filtered_by_greater_than_or_equal(
-                    {table_name}, {"*"}, condition_column_name, condition_column_value, false, {}));
-        }
+        const auto start = QueryProfiler::checkpoint();
 
-        if (comparison_operator == "<") {
-            results_and_comparison_operators.push_back(
-                where_clause_parser.get_data_filtered_by_less_than(
-                    {table_name}, {"*"}, condition_column_name, condition_column_value, false, {}));
+        for (auto column_and_new_value : columns_and_new_values) {
+            parser.database->get_table_by_name(table_name).update_all_rows(
+                column_and_new_value.at(0), column_and_new_value.at(2));
         }
 
-        if (comparison_operator == "<=") {
-            results_and_comparison_operators.push_back(
-                where_clause_parser.get_data_filtered_by_less_than_or_equal(
-                    {table_name}, {"*"}, condition_column_name, condition_column_value, false, {}));
+        if (parser.profiler) {
+            const auto row_count = parser.database->get_table_by_name(table_name).row_count();
+            parser.profiler->record(description, row_count, row_count, 0, start);
         }
+        return;
+    }
 
-        if (comparison_operator == "LIKE") {
-            results_and_comparison_operators.push_back(
-                where_clause_parser.get_data_filtered_by_like(
-                    {table_name}, {"*"}, condition_column_name, condition_column_value, false, {}));
-        }
+    const auto specific_row_ids = where_clause_parser.get_row_ids_filtered_by(table_name, query_elements, where_clause_index);
+    const auto description = fmt::format("Update {} of matching rows of '{}'", fmt::join(column_names, ", "), table_name);
 
-        if (it + 3 < query_elements.end()) results_and_comparison_operators.push_back({{*(it + 3)}});
+    if (parser.profiler && !parser.profiler->is_analyze) {
+        parser.profiler->record(description);
+        return;
     }
 
-    if (results_and_comparison_operators.size() == 1 && results_and_comparison_operators.at(0).empty()) {
+    if (specific_row_ids.empty()) {
         fmt::println("No rows were updated because no records met the specified criteria");
         return;
     }
 
-    auto results = std::vector<std::vector<std::string>>{};
-    auto current_comparison_operator = std::string("");
-    for (auto part : results_and_comparison_operators) {
-
-        if (part.empty() && (current_comparison_operator == "&&" || current_comparison_operator == "AND")) {
-            results.clear();
-            current_comparison_operator.clear();
-            continue;
-        }
-
-        if (part.empty() && (current_comparison_operator == "||" || current_comparison_operator == "OR")) continue;
-
-        if (part.at(0).size() == 1 && (
-                part.at(0).at(0) == "&&" ||
-                part.at(0).at(0) == "||" ||
-                part.at(0).at(0) == "AND" ||
-                part.at(0).at(0) == "OR")
-            ) {
-            current_comparison_operator = part.at(0).at(0);
-            continue;
-        }
-
-        for (auto& row : part) {
-            if (current_comparison_operator.empty()) results.push_back(row);
-            else {
-                if (current_comparison_operator == "&&" || current_comparison_operator == "AND") {
-                    auto temp_results = std::vector<std::vector<std::string>>{};
-
-                    for (const auto& existing_row : results) {
-                        if (std::ranges::find(part, existing_row) != part.end()) temp_results.push_back(existing_row);
-                    }
-
-                    results = temp_results;
-
-                    if (results.empty()) break;
-                }
-
-                if (current_comparison_operator == "||" || current_comparison_operator == "OR") {
-                    if (std::ranges::find(results, row) == results.end()) results.push_back(row);
-                }
-            }
-        }
-
-        current_comparison_operator.clear();
-    }
+    const auto start = QueryProfiler::checkpoint();
+    parser.database->get_table_by_name(table_name).update_specific_rows(specific_row_ids, columns_and_new_values);
 
-    parser.database->get_table_by_name(table_name).update_specific_rows(results, columns_and_new_values);
+    if (parser.profiler) parser.profiler->record(description, specific_row_ids.size(), specific_row_ids.size(), 0, start);
 }
 
 auto UpdateParser::find_index(const std::vector<std::string> &vec, const std::string &value) -> int {
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <optional>
+#include <vector>
+
+#include "ast.h"
+#include "../table/table.h"
+
+struct JoinedColumn {
+    std::size_t table_index = 0;
+    int column_index = -1;
+
+    auto operator==(const JoinedColumn&) const -> bool = default;
+};
+
+struct OrderKey {
+    JoinedColumn column;
+    bool is_descending = false;
+};
+
+struct SelectedAggregate {
+    AggregateFunction function = AggregateFunction::NONE;
+    std::optional<JoinedColumn> column;
+};
+
+struct SelectPlan {
+    std::vector<const Table*> tables;
+    std::vector<std::vector<int>> column_indices;
+    std::vector<JoinedColumn> joined_columns;
+    std::vector<OrderKey> order_keys;
+    std::vector<JoinedColumn> group_columns;
+    std::vector<SelectedAggregate> selected_aggregates;
+};
+
+struct PreparedStatement {
+    SelectStatement statement;
+    std::vector<std::size_t> parameter_indices;
+    std::optional<SelectPlan> plan;
+};
@@ -0,0 +1,47 @@
+#include "queryprofiler.h"
+
+#include <fmt/format.h>
+
+auto QueryProfiler::checkpoint() -> Checkpoint {
+    return std::chrono::steady_clock::now();
+}
+
+auto QueryProfiler::record(std::string description) -> void {
+    operators.push_back({std::move(description), 0, 0, 0, {}});
+}
+
+auto QueryProfiler::record(
+    std::string description,
+    const std::size_t rows_in,
+    const std::size_t rows_out,
+    const std::size_t allocated_bytes,
+    const Checkpoint& start
+) -> void {
+    operators.push_back({std::move(description), rows_in, rows_out, allocated_bytes, checkpoint() - start});
+}
+
+auto QueryProfiler::print(const Checkpoint& start) const -> void {
+    const auto elapsed_time = checkpoint() - start;
+
+    fmt::println("Query plan:");
+
+    auto total_allocated_bytes = std::size_t{0};
+
+    for (auto i = std::size_t{0}; i < operators.size(); ++i) {
+        const auto& [description, rows_in, rows_out, allocated_bytes, operator_time] = operators[i];
+        total_allocated_bytes += allocated_bytes;
+
+        if (!is_analyze) fmt::println("{:>3}. {}", i + 1, description);
+        else {
+            fmt::println(
+                "{:>3}. {} (rows in: {}, rows out: {}, time: {:.3f} ms, allocated: {} B)",
+                i + 1, description, rows_in, rows_out, to_milliseconds(operator_time), allocated_bytes);
+        }
+    }
+
+    if (is_analyze) fmt::println("Total time: {:.3f} ms, allocated: {} B", to_milliseconds(elapsed_time), total_allocated_bytes);
+}
+
+auto QueryProfiler::to_milliseconds(const std::chrono::nanoseconds elapsed_time) -> double {
+    return std::chrono::duration<double, std::milli>(elapsed_time).count();
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+class QueryProfiler {
+public:
+    using Checkpoint = std::chrono::steady_clock::time_point;
+
+    bool is_analyze = false;
+
+    explicit QueryProfiler(const bool is_analyze) : is_analyze(is_analyze) {}
+
+    [[nodiscard]] static auto checkpoint() -> Checkpoint;
+
+    auto record(std::string description) -> void;
+
+    auto record(
+        std::string description,
+        std::size_t rows_in,
+        std::size_t rows_out,
+        std::size_t allocated_bytes,
+        const Checkpoint& start
+    ) -> void;
+
+    auto print(const Checkpoint& start) const -> void;
+
+private:
+    struct Operator {
+        std::string description;
+        std::size_t rows_in = 0;
+        std::size_t rows_out = 0;
+        std::size_t allocated_bytes = 0;
+        std::chrono::nanoseconds elapsed_time{};
+    };
+
+    std::vector<Operator> operators;
+
+    static auto to_milliseconds(std::chrono::nanoseconds elapsed_time) -> double;
+};
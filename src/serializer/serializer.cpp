@@ -2,6 +2,7 @@
 
 #include <fstream>
 #include <ranges>
+#include <sstream>
 #include <fmt/ostream.h>
 
 auto format_as(const ColumnType column_type) {
@@ -71,8 +72,13 @@ auto Serializer::save_databases_to_file() -> void {
             fmt::println(file, "{}", table.column_constraints);
             fmt::println(file, "{}", table.column_foreign_keys);
 
-            for (const auto& row : table.rows) {
-                fmt::println(file, "{}", row);
+            for (int i = 0; i < table.column_names.size(); i++) {
+                if (table.ordered_indexes.at(i)) fmt::println(file, "INDEX {}", table.column_names.at(i));
+                if (table.columns.at(i).is_dictionary_encoded()) fmt::println(file, "DICTIONARY {}", table.column_names.at(i));
+            }
+
+            for (auto i = std::size_t{0}; i < table.row_count(); ++i) {
+                fmt::println(file, "{}", format_row(table.get_row(i)));
             }
         }
         fmt::println(file, "{}", "-");
@@ -98,6 +104,8 @@ auto Serializer::upload_databases_from_file() -> void {
     auto column_constraints = std::vector<std::vector<Constraint>>{};
     auto column_foreign_keys = std::vector<std::pair<Table*, std::string>>{};
     auto rows = std::vector<std::vector<std::string>>{};
+    auto indexed_column_names = std::vector<std::string>{};
+    auto dictionary_column_names = std::vector<std::string>{};
     auto line_number = 0;
     auto repeat_iteration = false;
 
@@ -126,6 +134,8 @@ auto Serializer::upload_databases_from_file() -> void {
                 column_constraints.clear();
                 column_foreign_keys.clear();
                 rows.clear();
+                indexed_column_names.clear();
+                dictionary_column_names.clear();
 
                 handled_by_switch = true;
                 repeat_iteration = false;
@@ -165,6 +175,14 @@ auto Serializer::upload_databases_from_file() -> void {
         }
 
         if (handled_by_switch) continue;
+        if (line.starts_with("INDEX ")) {
+            indexed_column_names.push_back(line.substr(6));
+            continue;
+        }
+        if (line.starts_with("DICTIONARY ")) {
+            dictionary_column_names.push_back(line.substr(11));
+            continue;
+        }
         if (line.starts_with("[")) rows.push_back(parse_vector(line));
         if (!line.starts_with("[") && current_database) {
             current_database->create_table(
@@ -175,7 +193,16 @@ auto Serializer::upload_databases_from_file() -> void {
                     column_foreign_keys
             );
 
-            for (const auto& row : rows) current_database->insert_data(table_name, row);
+            for (const auto& column_name : dictionary_column_names) {
+                current_database->get_table_by_name(table_name).create_dictionary(column_name);
+            }
+            auto& table = current_database->get_table_by_name(table_name);
+            if (table.insert_rows(rows) == 0) {
+                for (const auto& row : rows) table.insert_row(row);
+            }
+            for (const auto& column_name : indexed_column_names) {
+                current_database->get_table_by_name(table_name).create_ordered_index(column_name);
+            }
 
             if (line == "-") {
                 line_number = 0;
@@ -191,21 +218,64 @@ auto Serializer::upload_databases_from_file() -> void {
     fmt::println("Successfully uploaded databases data from file!");
 }
 
+auto Serializer::format_row(const std::vector<std::string>& values) -> std::string {
+    auto line = std::string("[");
+
+    for (auto i = std::size_t{0}; i < values.size(); ++i) {
+        if (i > 0) line += ", ";
+        line += '"';
+
+        for (const auto character : values[i]) {
+            switch (character) {
+                case '\n': line += "\\n"; break;
+                case '\r': line += "\\r"; break;
+                case '"':
+                case '\\': {
+                    line += '\\';
+                    line += character;
+                } break;
+                default: line += character;
+            }
+        }
+
+        line += '"';
+    }
+
+    return line + "]";
+}
+
 auto Serializer::parse_vector(const std::string& line) -> std::vector<std::string> {
     auto result = std::vector<std::string>{};
 
     const auto cleaned = line.substr(1, line.size() - 2);
+    auto position = cleaned.find_first_not_of(" \t");
 
-    auto ss = std::stringstream(cleaned);
-    auto item = std::string("");
+    while (position != std::string::npos) {
+        auto item = std::string("");
 
-    while (std::getline(ss, item, ',')) {
-        item = item.erase(0, item.find_first_not_of(" \t"));
-        item = item.erase(item.find_last_not_of(" \t") + 1);
+        if (cleaned[position] == '"') {
+            for (++position; position < cleaned.size() && cleaned[position] != '"'; ++position) {
+                if (cleaned[position] != '\\' || position + 1 == cleaned.size()) {
+                    item += cleaned[position];
+                    continue;
+                }
 
-        if (item.front() == '"' && item.back() == '"') item = item.substr(1, item.size() - 2);
+                switch (cleaned[++position]) {
+                    case 'n': item += '\n'; break;
+                    case 'r': item += '\r'; break;
+                    case 't': item += '\t'; break;
+                    default: item += cleaned[position];
+                }
+            }
+        } else {
+            item = cleaned.substr(position, cleaned.find(',', position) - position);
+            item = item.erase(item.find_last_not_of(" \t") + 1);
+        }
 
         result.push_back(item);
+
+        position = cleaned.find(',', position);
+        if (position != std::string::npos) position = cleaned.find_first_not_of(" \t", position + 1);
     }
 
     return result;
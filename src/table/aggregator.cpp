@@ -0,0 +1,258 @@
+#include "aggregator.h"
+
+#include <bit>
+#include <limits>
+#include <numeric>
+#include <thread>
+#include <fmt/format.h>
+
+#include "rowsorter.h"
+
+auto Aggregator::aggregate(const std::vector<std::size_t>& positions) -> void {
+    this->positions = &positions;
+    joined_rows = nullptr;
+
+    aggregate_rows(positions.size());
+}
+
+auto Aggregator::aggregate(const std::vector<std::vector<std::optional<std::size_t>>>& joined_rows) -> void {
+    positions = nullptr;
+    this->joined_rows = &joined_rows;
+
+    aggregate_rows(joined_rows.size());
+}
+
+auto Aggregator::get_group_rows() const -> const std::vector<std::size_t>& {
+    return group_rows;
+}
+
+auto Aggregator::get_allocated_bytes() const -> std::size_t {
+    return allocated_bytes;
+}
+
+auto Aggregator::get_value(const std::size_t group, const std::size_t column_index) const -> std::string {
+    const auto& [function, column, table_index] = aggregate_columns[column_index];
+    const auto& state = states[group * aggregate_columns.size() + column_index];
+    const auto is_integer = column && column->type == ColumnType::INTEGER;
+
+    switch (function) {
+        case AggregateFunction::COUNT: return std::to_string(state.count);
+        case AggregateFunction::SUM: {
+            if (state.count == 0) return {};
+            return is_integer ? std::to_string(state.integer_sum) : fmt::format("{}", state.float_sum);
+        }
+        case AggregateFunction::AVG: {
+            if (state.count == 0) return {};
+
+            const auto sum = is_integer ? static_cast<double>(state.integer_sum) : state.float_sum;
+            return fmt::format("{}", sum / static_cast<double>(state.count));
+        }
+        case AggregateFunction::MIN:
+        case AggregateFunction::MAX:
+            return state.extreme_position ? column->get_value(*state.extreme_position) : std::string();
+        default: {
+            const auto position = position_of(group_rows[group], table_index);
+            return position ? column->get_value(*position) : std::string();
+        }
+    }
+}
+
+auto Aggregator::aggregate_rows(const std::size_t row_count) -> void {
+    const auto thread_count = row_count < parallel_aggregation_min_rows ? std::size_t{1} : std::size_t{std::max(std::thread::hardware_concurrency(), 1u)};
+    auto hashes = std::vector<std::size_t>(row_count);
+
+    if (thread_count == 1) {
+        for (auto row = std::size_t{0}; row < row_count; ++row) hashes[row] = hash_row(row);
+
+        auto rows = std::vector<std::size_t>(row_count);
+        std::iota(rows.begin(), rows.end(), std::size_t{0});
+
+        auto partition = aggregate_partition(rows, hashes);
+        group_rows = std::move(partition.group_rows);
+        states = std::move(partition.states);
+        allocated_bytes = (hashes.capacity() + rows.capacity()) * sizeof(std::size_t) + partition.allocated_bytes;
+    } else {
+        {
+            auto threads = std::vector<std::jthread>{};
+
+            for (auto i = std::size_t{0}; i < thread_count; ++i) {
+                threads.emplace_back([&, i] {
+                    for (auto row = row_count * i / thread_count; row < row_count * (i + 1) / thread_count; ++row) hashes[row] = hash_row(row);
+                });
+            }
+        }
+
+        const auto partition_of = [&](const std::size_t hash) { return (hash * 0x9E3779B97F4A7C15ULL >> 32) % thread_count; };
+        auto partitions = std::vector<Partition>(thread_count);
+
+        {
+            auto threads = std::vector<std::jthread>{};
+
+            for (auto i = std::size_t{0}; i < thread_count; ++i) {
+                threads.emplace_back([&, i] {
+                    auto rows = std::vector<std::size_t>{};
+                    for (auto row = std::size_t{0}; row < row_count; ++row) {
+                        if (partition_of(hashes[row]) == i) rows.push_back(row);
+                    }
+
+                    partitions[i] = aggregate_partition(rows, hashes);
+                    partitions[i].allocated_bytes += rows.capacity() * sizeof(std::size_t);
+                });
+            }
+        }
+
+        auto partition_groups = std::vector<std::pair<std::size_t, std::size_t>>{};
+
+        for (auto i = std::size_t{0}; i < thread_count; ++i) {
+            for (auto group = std::size_t{0}; group < partitions[i].group_rows.size(); ++group) partition_groups.emplace_back(i, group);
+        }
+
+        std::ranges::sort(partition_groups, {}, [&](const auto& partition_group) {
+            return partitions[partition_group.first].group_rows[partition_group.second];
+        });
+
+        group_rows.clear();
+        states.clear();
+        group_rows.reserve(partition_groups.size());
+        states.reserve(partition_groups.size() * aggregate_columns.size());
+
+        for (const auto& [partition_index, group] : partition_groups) {
+            const auto& partition = partitions[partition_index];
+            const auto group_states = partition.states.begin() + static_cast<std::ptrdiff_t>(group * aggregate_columns.size());
+
+            group_rows.push_back(partition.group_rows[group]);
+            states.insert(states.end(), group_states, group_states + static_cast<std::ptrdiff_t>(aggregate_columns.size()));
+        }
+
+        allocated_bytes = (hashes.capacity() + partition_groups.capacity() * 2 + group_rows.capacity()) * sizeof(std::size_t) +
+            states.capacity() * sizeof(AggregateState);
+        for (const auto& partition : partitions) allocated_bytes += partition.allocated_bytes;
+    }
+
+    if (group_keys.empty() && group_rows.empty()) {
+        group_rows.push_back(0);
+        states.resize(aggregate_columns.size());
+    }
+}
+
+auto Aggregator::aggregate_partition(const std::vector<std::size_t>& rows, const std::vector<std::size_t>& hashes) const -> Partition {
+    constexpr auto no_group = std::numeric_limits<std::size_t>::max();
+
+    auto partition = Partition{};
+    auto bucket_heads = std::vector<std::size_t>(initial_bucket_count, no_group);
+    auto next_groups = std::vector<std::size_t>{};
+    auto group_hashes = std::vector<std::size_t>{};
+    auto bucket_shift = 64 - std::countr_zero(bucket_heads.size());
+
+    const auto to_bucket = [&](const std::uint64_t hash) { return hash * 0x9E3779B97F4A7C15ULL >> bucket_shift; };
+    const auto link_group = [&](const std::size_t group) {
+        auto& bucket_head = bucket_heads[to_bucket(group_hashes[group])];
+        next_groups[group] = bucket_head;
+        bucket_head = group;
+    };
+
+    for (const auto row : rows) {
+        const auto hash = hashes[row];
+        auto group = bucket_heads[to_bucket(hash)];
+
+        while (group != no_group && (group_hashes[group] != hash || !is_same_group(row, partition.group_rows[group]))) {
+            group = next_groups[group];
+        }
+
+        if (group == no_group) {
+            group = partition.group_rows.size();
+            partition.group_rows.push_back(row);
+            partition.states.resize(partition.states.size() + aggregate_columns.size());
+            group_hashes.push_back(hash);
+            next_groups.push_back(no_group);
+
+            if (partition.group_rows.size() > bucket_heads.size()) {
+                bucket_heads.assign(bucket_heads.size() * 2, no_group);
+                bucket_shift = 64 - std::countr_zero(bucket_heads.size());
+
+                for (auto other_group = std::size_t{0}; other_group < partition.group_rows.size(); ++other_group) link_group(other_group);
+            } else link_group(group);
+        }
+
+        update_states(&partition.states[group * aggregate_columns.size()], row);
+    }
+
+    partition.allocated_bytes =
+        (bucket_heads.capacity() + next_groups.capacity() + group_hashes.capacity() + partition.group_rows.capacity()) * sizeof(std::size_t) +
+        partition.states.capacity() * sizeof(AggregateState);
+
+    return partition;
+}
+
+auto Aggregator::update_states(AggregateState* row_states, const std::size_t row) const -> void {
+    for (auto i = std::size_t{0}; i < aggregate_columns.size(); ++i) {
+        const auto& [function, column, table_index] = aggregate_columns[i];
+        auto& state = row_states[i];
+
+        if (function == AggregateFunction::NONE) continue;
+
+        if (!column) {
+            ++state.count;
+            continue;
+        }
+
+        const auto position = position_of(row, table_index);
+        if (!position || column->is_null(*position)) continue;
+
+        ++state.count;
+
+        switch (function) {
+            case AggregateFunction::SUM:
+            case AggregateFunction::AVG: {
+                if (column->type == ColumnType::INTEGER) state.integer_sum += column->get_integer(*position);
+                else state.float_sum += column->get_float(*position);
+            } break;
+
+            case AggregateFunction::MIN: {
+                if (!state.extreme_position || RowSorter::compare_values(*column, position, state.extreme_position) < 0) state.extreme_position = position;
+            } break;
+
+            case AggregateFunction::MAX: {
+                if (!state.extreme_position || RowSorter::compare_values(*column, position, state.extreme_position) > 0) state.extreme_position = position;
+            } break;
+
+            default:
+                break;
+        }
+    }
+}
+
+auto Aggregator::position_of(const std::size_t row, const std::size_t table_index) const -> std::optional<std::size_t> {
+    if (joined_rows) return (*joined_rows)[row][table_index];
+
+    return (*positions)[row];
+}
+
+auto Aggregator::hash_row(const std::size_t row) const -> std::size_t {
+    auto hash = std::size_t{0};
+
+    for (const auto& [column, table_index] : group_keys) {
+        const auto position = position_of(row, table_index);
+        hash = (hash ^ (position ? column->hash(*position) : Column::null_hash)) * 0x100000001B3ULL;
+    }
+
+    return hash;
+}
+
+auto Aggregator::is_same_group(const std::size_t row, const std::size_t other_row) const -> bool {
+    for (const auto& [column, table_index] : group_keys) {
+        const auto position = position_of(row, table_index);
+        const auto other_position = position_of(other_row, table_index);
+        const auto is_null = !position || column->is_null(*position);
+        const auto is_other_null = !other_position || column->is_null(*other_position);
+
+        if (is_null || is_other_null) {
+            if (is_null != is_other_null) return false;
+            continue;
+        }
+
+        if (!column->equals(*position, *column, *other_position)) return false;
+    }
+
+    return true;
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "column.h"
+#include "../enums/aggregatefunction.h"
+
+class Aggregator {
+public:
+    struct GroupKey {
+        const Column* column = nullptr;
+        std::size_t table_index = 0;
+    };
+
+    struct AggregateColumn {
+        AggregateFunction function = AggregateFunction::NONE;
+        const Column* column = nullptr;
+        std::size_t table_index = 0;
+    };
+
+    Aggregator(std::vector<GroupKey> group_keys, std::vector<AggregateColumn> aggregate_columns) :
+        group_keys(std::move(group_keys)), aggregate_columns(std::move(aggregate_columns)) {}
+
+    auto aggregate(const std::vector<std::size_t>& positions) -> void;
+
+    auto aggregate(const std::vector<std::vector<std::optional<std::size_t>>>& joined_rows) -> void;
+
+    [[nodiscard]] auto get_group_rows() const -> const std::vector<std::size_t>&;
+
+    [[nodiscard]] auto get_value(std::size_t group, std::size_t column_index) const -> std::string;
+
+    [[nodiscard]] auto get_allocated_bytes() const -> std::size_t;
+
+private:
+    struct AggregateState {
+        std::int64_t count = 0;
+        std::int64_t integer_sum = 0;
+        double float_sum = 0.0;
+        std::optional<std::size_t> extreme_position;
+    };
+
+    struct Partition {
+        std::vector<std::size_t> group_rows;
+        std::vector<AggregateState> states;
+        std::size_t allocated_bytes = 0;
+    };
+
+    static constexpr std::size_t parallel_aggregation_min_rows = std::size_t{1} << 18;
+    static constexpr std::size_t initial_bucket_count = 1024;
+
+    std::vector<GroupKey> group_keys;
+    std::vector<AggregateColumn> aggregate_columns;
+    const std::vector<std::size_t>* positions = nullptr;
+    const std::vector<std::vector<std::optional<std::size_t>>>* joined_rows = nullptr;
+    std::vector<std::size_t> group_rows;
+    std::vector<AggregateState> states;
+    std::size_t allocated_bytes = 0;
+
+    auto aggregate_rows(std::size_t row_count) -> void;
+
+    [[nodiscard]] auto aggregate_partition(const std::vector<std::size_t>& rows, const std::vector<std::size_t>& hashes) const -> Partition;
+
+    auto update_states(AggregateState* row_states, std::size_t row) const -> void;
+
+    [[nodiscard]] auto position_of(std::size_t row, std::size_t table_index) const -> std::optional<std::size_t>;
+
+    [[nodiscard]] auto hash_row(std::size_t row) const -> std::size_t;
+
+    [[nodiscard]] auto is_same_group(std::size_t row, std::size_t other_row) const -> bool;
+};
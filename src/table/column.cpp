@@ -0,0 +1,368 @@
+#include "column.h"
+#include "predicate.h"
+
+#include <algorithm>
+#include <charconv>
+
+auto Column::size() const -> std::size_t {
+    return nulls.size();
+}
+
+auto Column::is_null(const std::size_t position) const -> bool {
+    return nulls[position];
+}
+
+auto Column::get_integer(const std::size_t position) const -> std::int64_t {
+    return integers[position];
+}
+
+auto Column::get_float(const std::size_t position) const -> double {
+    return floats[position];
+}
+
+auto Column::get_text(const std::size_t position) const -> std::string_view {
+    if (dictionary_encoded) return dictionary[codes[position]];
+    return std::string_view(text_bytes).substr(text_offsets[position], text_offsets[position + 1] - text_offsets[position]);
+}
+
+auto Column::get_value(const std::size_t position) const -> std::string {
+    if (type != ColumnType::INTEGER && type != ColumnType::FLOAT) return std::string(get_text(position));
+    if (nulls[position]) return {};
+
+    char buffer[32];
+    const auto [end, error] = type == ColumnType::INTEGER ?
+        std::to_chars(buffer, buffer + sizeof(buffer), integers[position]) :
+        std::to_chars(buffer, buffer + sizeof(buffer), floats[position]);
+
+    return std::string(buffer, end);
+}
+
+auto Column::equals(const std::size_t position, const Column& other, const std::size_t other_position) const -> bool {
+    if (nulls[position] || other.nulls[other_position]) return nulls[position] == other.nulls[other_position];
+
+    if (type == ColumnType::INTEGER && other.type == ColumnType::INTEGER) {
+        return integers[position] == other.integers[other_position];
+    }
+
+    const auto is_number = type == ColumnType::INTEGER || type == ColumnType::FLOAT;
+    const auto is_other_number = other.type == ColumnType::INTEGER || other.type == ColumnType::FLOAT;
+
+    if (is_number && is_other_number) {
+        const auto value = type == ColumnType::INTEGER ? static_cast<double>(integers[position]) : floats[position];
+        const auto other_value = other.type == ColumnType::INTEGER ? static_cast<double>(other.integers[other_position]) : other.floats[other_position];
+        return value == other_value;
+    }
+
+    if (!is_number && !is_other_number) return get_text(position) == other.get_text(other_position);
+
+    return get_value(position) == other.get_value(other_position);
+}
+
+auto Column::equals(
+    const std::size_t position,
+    const Column& other,
+    const std::size_t other_position,
+    const std::vector<std::uint32_t>& other_codes
+) const -> bool {
+    if (other_codes.empty()) return equals(position, other, other_position);
+
+    return codes[position] == other_codes[other.codes[other_position]];
+}
+
+auto Column::hash(const std::size_t position) const -> std::size_t {
+    if (nulls[position]) return null_hash;
+
+    switch (type) {
+        case ColumnType::INTEGER: return std::hash<std::int64_t>{}(integers[position]);
+        case ColumnType::FLOAT: return std::hash<double>{}(floats[position] == 0.0 ? 0.0 : floats[position]);
+        default: return std::hash<std::string_view>{}(get_text(position));
+    }
+}
+
+auto Column::is_dictionary_encoded() const -> bool {
+    return dictionary_encoded;
+}
+
+auto Column::find_code(const std::string_view value) const -> std::optional<std::uint32_t> {
+    const auto it = dictionary_codes.find(value);
+    if (it == dictionary_codes.end()) return std::nullopt;
+
+    return it->second;
+}
+
+auto Column::translate_codes(const Column& other) const -> std::vector<std::uint32_t> {
+    if (!dictionary_encoded || !other.dictionary_encoded) return {};
+
+    auto translated_codes = std::vector<std::uint32_t>{};
+    translated_codes.reserve(other.dictionary.size());
+
+    for (const auto& value : other.dictionary) translated_codes.push_back(find_code(value).value_or(no_code));
+
+    return translated_codes;
+}
+
+auto Column::contains(const std::string& value) const -> bool {
+    return !filter("=", value).empty();
+}
+
+auto Column::filter(const std::string& comparison_operator, const std::string& value) const -> std::vector<std::size_t> {
+    return Predicate(*this, comparison_operator, value).filter();
+}
+
+auto Column::push_back(const std::string& value) -> void {
+    auto parsed_value = ParsedValue{};
+    const auto is_valid = parse_value(value, type, parsed_value) == ParseResult::VALID;
+
+    if (type == ColumnType::INTEGER || type == ColumnType::FLOAT) {
+        push_back(is_valid ? std::string_view(value) : std::string_view(), parsed_value);
+        return;
+    }
+
+    push_back(value, parsed_value);
+}
+
+auto Column::push_back(const std::string_view value, const ParsedValue& parsed_value) -> void {
+    switch (type) {
+        case ColumnType::INTEGER: {
+            integers.push_back(parsed_value.integer);
+            nulls.push_back(value.empty());
+        } break;
+
+        case ColumnType::FLOAT: {
+            floats.push_back(parsed_value.floating);
+            nulls.push_back(value.empty());
+        } break;
+
+        default: {
+            if (dictionary_encoded) codes.push_back(intern(value));
+            else {
+                text_bytes.append(value);
+                text_offsets.push_back(text_bytes.size());
+            }
+            nulls.push_back(value.empty());
+        } break;
+    }
+}
+
+auto Column::push_null() -> void {
+    push_back("");
+}
+
+auto Column::append(const Column& other) -> void {
+    switch (type) {
+        case ColumnType::INTEGER: integers.insert(integers.end(), other.integers.begin(), other.integers.end()); break;
+        case ColumnType::FLOAT: floats.insert(floats.end(), other.floats.begin(), other.floats.end()); break;
+        default: {
+            if (dictionary_encoded) {
+                codes.reserve(codes.size() + other.size());
+                for (auto i = std::size_t{0}; i < other.size(); ++i) codes.push_back(intern(other.get_text(i)));
+            } else {
+                text_offsets.reserve(text_offsets.size() + other.size());
+                for (auto i = std::size_t{0}; i < other.size(); ++i) {
+                    text_bytes.append(other.get_text(i));
+                    text_offsets.push_back(text_bytes.size());
+                }
+            }
+        } break;
+    }
+
+    nulls.insert(nulls.end(), other.nulls.begin(), other.nulls.end());
+}
+
+auto Column::set(const std::vector<std::size_t>& positions, const std::string& value, const ParsedValue& parsed_value) -> void {
+    if (type == ColumnType::INTEGER || type == ColumnType::FLOAT) {
+        for (const auto position : positions) {
+            if (type == ColumnType::INTEGER) integers[position] = parsed_value.integer;
+            else floats[position] = parsed_value.floating;
+            nulls[position] = value.empty();
+        }
+        return;
+    }
+
+    if (dictionary_encoded) {
+        const auto code = intern(value);
+
+        for (const auto position : positions) {
+            codes[position] = code;
+            nulls[position] = value.empty();
+        }
+        return;
+    }
+
+    auto updated_positions = std::vector<bool>(size());
+    for (const auto position : positions) updated_positions[position] = true;
+
+    auto new_offsets = std::vector<std::size_t>{0};
+    auto new_bytes = std::string();
+    new_offsets.reserve(text_offsets.size());
+    new_bytes.reserve(text_bytes.size());
+
+    for (auto i = std::size_t{0}; i < size(); ++i) {
+        if (updated_positions[i]) {
+            new_bytes.append(value);
+            nulls[i] = value.empty();
+        } else new_bytes.append(get_text(i));
+
+        new_offsets.push_back(new_bytes.size());
+    }
+
+    text_offsets = std::move(new_offsets);
+    text_bytes = std::move(new_bytes);
+}
+
+auto Column::set_all(const std::string& value, const ParsedValue& parsed_value) -> void {
+    auto positions = std::vector<std::size_t>(size());
+    for (auto i = std::size_t{0}; i < size(); ++i) positions[i] = i;
+    set(positions, value, parsed_value);
+}
+
+auto Column::erase(const std::vector<bool>& erased_positions) -> void {
+    auto kept = std::size_t{0};
+    auto new_bytes = std::string();
+
+    if (type != ColumnType::INTEGER && type != ColumnType::FLOAT && !dictionary_encoded) new_bytes.reserve(text_bytes.size());
+
+    for (auto i = std::size_t{0}; i < size(); ++i) {
+        if (erased_positions[i]) continue;
+
+        switch (type) {
+            case ColumnType::INTEGER: integers[kept] = integers[i]; break;
+            case ColumnType::FLOAT: floats[kept] = floats[i]; break;
+            default: {
+                if (dictionary_encoded) codes[kept] = codes[i];
+                else {
+                    new_bytes.append(get_text(i));
+                    text_offsets[kept + 1] = new_bytes.size();
+                }
+            } break;
+        }
+
+        nulls[kept] = nulls[i];
+        ++kept;
+    }
+
+    if (type == ColumnType::INTEGER) integers.resize(kept);
+    else if (type == ColumnType::FLOAT) floats.resize(kept);
+    else if (dictionary_encoded) codes.resize(kept);
+    else {
+        text_offsets.resize(kept + 1);
+        text_bytes = std::move(new_bytes);
+    }
+
+    nulls.resize(kept);
+}
+
+auto Column::clear() -> void {
+    integers.clear();
+    floats.clear();
+    text_offsets = {0};
+    text_bytes.clear();
+    nulls.clear();
+    codes.clear();
+    dictionary.clear();
+    dictionary_codes.clear();
+}
+
+auto Column::encode_dictionary() -> void {
+    if (type == ColumnType::INTEGER || type == ColumnType::FLOAT || dictionary_encoded) return;
+
+    codes.reserve(size());
+    for (auto i = std::size_t{0}; i < size(); ++i) codes.push_back(intern(get_text(i)));
+
+    dictionary_encoded = true;
+    text_offsets = {0};
+    text_bytes = std::string();
+}
+
+auto Column::decode_dictionary() -> void {
+    if (!dictionary_encoded) return;
+
+    for (const auto code : codes) {
+        text_bytes.append(dictionary[code]);
+        text_offsets.push_back(text_bytes.size());
+    }
+
+    dictionary_encoded = false;
+    codes = std::vector<std::uint32_t>();
+    dictionary = std::vector<std::string>();
+    dictionary_codes.clear();
+}
+
+auto Column::parse_value(const std::string_view value, const ColumnType type, ParsedValue& parsed_value) -> ParseResult {
+    const auto begin = value.data() + (value.starts_with('+') ? 1 : 0);
+    const auto end = value.data() + value.size();
+
+    switch (type) {
+        case ColumnType::INTEGER: {
+            if (!is_integer_literal(value)) return ParseResult::INVALID;
+            if (std::from_chars(begin, end, parsed_value.integer).ec != std::errc{}) return ParseResult::OUT_OF_RANGE;
+        } break;
+
+        case ColumnType::FLOAT: {
+            if (!is_float_literal(value)) return ParseResult::INVALID;
+            if (std::from_chars(begin, end, parsed_value.floating).ec != std::errc{}) return ParseResult::OUT_OF_RANGE;
+        } break;
+
+        default:
+            break;
+    }
+
+    return ParseResult::VALID;
+}
+
+auto Column::parse_integer(const std::string_view value, std::int64_t& result) -> bool {
+    auto parsed_value = ParsedValue{};
+    if (parse_value(value, ColumnType::INTEGER, parsed_value) != ParseResult::VALID) return false;
+
+    result = parsed_value.integer;
+    return true;
+}
+
+auto Column::parse_float(const std::string_view value, double& result) -> bool {
+    auto parsed_value = ParsedValue{};
+    if (parse_value(value, ColumnType::FLOAT, parsed_value) != ParseResult::VALID) return false;
+
+    result = parsed_value.floating;
+    return true;
+}
+
+auto Column::is_integer_literal(const std::string_view value) -> bool {
+    const auto digits = value.substr(value.starts_with('+') || value.starts_with('-') ? 1 : 0);
+
+    return !digits.empty() && std::ranges::all_of(digits, [](const char c) { return c >= '0' && c <= '9'; });
+}
+
+auto Column::is_float_literal(const std::string_view value) -> bool {
+    const auto is_digit = [](const char c) { return c >= '0' && c <= '9'; };
+    auto i = value.starts_with('+') || value.starts_with('-') ? std::size_t{1} : std::size_t{0};
+
+    const auto integer_begin = i;
+    while (i < value.size() && is_digit(value[i])) ++i;
+
+    if (i < value.size() && value[i] == '.') {
+        const auto fraction_begin = ++i;
+        while (i < value.size() && is_digit(value[i])) ++i;
+        if (i == fraction_begin) return false;
+    } else if (i == integer_begin) return false;
+
+    if (i < value.size() && (value[i] == 'e' || value[i] == 'E')) {
+        ++i;
+        if (i < value.size() && (value[i] == '+' || value[i] == '-')) ++i;
+
+        const auto exponent_begin = i;
+        while (i < value.size() && is_digit(value[i])) ++i;
+        if (i == exponent_begin) return false;
+    }
+
+    return i == value.size();
+}
+
+auto Column::intern(const std::string_view value) -> std::uint32_t {
+    if (const auto it = dictionary_codes.find(value); it != dictionary_codes.end()) return it->second;
+
+    const auto code = static_cast<std::uint32_t>(dictionary.size());
+    dictionary.emplace_back(value);
+    dictionary_codes.emplace(dictionary.back(), code);
+
+    return code;
+}
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "../enums/columntype.h"
+
+enum class ParseResult {
+    VALID,
+    INVALID,
+    OUT_OF_RANGE
+};
+
+struct ParsedValue {
+    std::int64_t integer = 0;
+    double floating = 0.0;
+};
+
+struct StringHash {
+    using is_transparent = void;
+
+    auto operator()(const std::string_view value) const -> std::size_t {
+        return std::hash<std::string_view>{}(value);
+    }
+};
+
+class Column {
+    friend class Predicate;
+
+public:
+    static constexpr std::uint32_t no_code = std::numeric_limits<std::uint32_t>::max();
+    static constexpr std::size_t null_hash = 0x9E3779B97F4A7C15ULL;
+
+    ColumnType type = ColumnType::INVALID;
+
+    Column() = default;
+
+    explicit Column(const ColumnType type) : type(type) {}
+
+    [[nodiscard]] auto size() const -> std::size_t;
+
+    [[nodiscard]] auto is_null(std::size_t position) const -> bool;
+
+    [[nodiscard]] auto get_integer(std::size_t position) const -> std::int64_t;
+
+    [[nodiscard]] auto get_float(std::size_t position) const -> double;
+
+    [[nodiscard]] auto get_text(std::size_t position) const -> std::string_view;
+
+    [[nodiscard]] auto get_value(std::size_t position) const -> std::string;
+
+    [[nodiscard]] auto equals(std::size_t position, const Column& other, std::size_t other_position) const -> bool;
+
+    [[nodiscard]] auto equals(
+        std::size_t position,
+        const Column& other,
+        std::size_t other_position,
+        const std::vector<std::uint32_t>& other_codes
+    ) const -> bool;
+
+    [[nodiscard]] auto hash(std::size_t position) const -> std::size_t;
+
+    [[nodiscard]] auto is_dictionary_encoded() const -> bool;
+
+    [[nodiscard]] auto find_code(std::string_view value) const -> std::optional<std::uint32_t>;
+
+    [[nodiscard]] auto translate_codes(const Column& other) const -> std::vector<std::uint32_t>;
+
+    [[nodiscard]] auto contains(const std::string& value) const -> bool;
+
+    [[nodiscard]] auto filter(const std::string& comparison_operator, const std::string& value) const -> std::vector<std::size_t>;
+
+    auto push_back(const std::string& value) -> void;
+
+    auto push_back(std::string_view value, const ParsedValue& parsed_value) -> void;
+
+    auto push_null() -> void;
+
+    auto append(const Column& other) -> void;
+
+    auto set(const std::vector<std::size_t>& positions, const std::string& value, const ParsedValue& parsed_value) -> void;
+
+    auto set_all(const std::string& value, const ParsedValue& parsed_value) -> void;
+
+    auto erase(const std::vector<bool>& erased_positions) -> void;
+
+    auto clear() -> void;
+
+    auto encode_dictionary() -> void;
+
+    auto decode_dictionary() -> void;
+
+    static auto parse_value(std::string_view value, ColumnType type, ParsedValue& parsed_value) -> ParseResult;
+
+    static auto parse_integer(std::string_view value, std::int64_t& result) -> bool;
+
+    static auto parse_float(std::string_view value, double& result) -> bool;
+
+private:
+    std::vector<std::int64_t> integers;
+    std::vector<double> floats;
+    std::vector<std::size_t> text_offsets = {0};
+    std::string text_bytes;
+    std::vector<bool> nulls;
+    bool dictionary_encoded = false;
+    std::vector<std::uint32_t> codes;
+    std::vector<std::string> dictionary;
+    std::unordered_map<std::string, std::uint32_t, StringHash, std::equal_to<>> dictionary_codes;
+
+    static auto is_integer_literal(std::string_view value) -> bool;
+
+    static auto is_float_literal(std::string_view value) -> bool;
+
+    auto intern(std::string_view value) -> std::uint32_t;
+};
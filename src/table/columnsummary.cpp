@@ -0,0 +1,65 @@
+#include "columnsummary.h"
+
+auto ColumnSummary::add(const Column& column, const std::size_t position) -> void {
+    if (column.is_null(position)) {
+        ++null_count;
+        return;
+    }
+
+    if (!min || compare(column, position, *min) < 0) min = make_extreme(column, position);
+    if (!max || compare(column, position, *max) > 0) max = make_extreme(column, position);
+}
+
+auto ColumnSummary::remove(const Column& column, const std::size_t position) -> void {
+    if (column.is_null(position)) {
+        --null_count;
+        return;
+    }
+
+    if (compare(column, position, *min) == 0 || compare(column, position, *max) == 0) is_stale = true;
+}
+
+auto ColumnSummary::refresh(const Column& column) -> void {
+    if (is_stale) rebuild(column);
+}
+
+auto ColumnSummary::rebuild(const Column& column) -> void {
+    clear();
+
+    for (auto position = std::size_t{0}; position < column.size(); ++position) add(column, position);
+}
+
+auto ColumnSummary::clear() -> void {
+    null_count = 0;
+    min.reset();
+    max.reset();
+    is_stale = false;
+}
+
+auto ColumnSummary::get_min() const -> std::string {
+    return min ? min->value : std::string();
+}
+
+auto ColumnSummary::get_max() const -> std::string {
+    return max ? max->value : std::string();
+}
+
+auto ColumnSummary::make_extreme(const Column& column, const std::size_t position) -> Extreme {
+    switch (column.type) {
+        case ColumnType::INTEGER: return {{.integer = column.get_integer(position)}, column.get_value(position)};
+        case ColumnType::FLOAT: return {{.floating = column.get_float(position)}, column.get_value(position)};
+        default: return {{}, column.get_value(position)};
+    }
+}
+
+auto ColumnSummary::compare(const Column& column, const std::size_t position, const Extreme& extreme) -> int {
+    const auto compare_values = [](const auto& value, const auto& other_value) {
+        return value < other_value ? -1 : other_value < value ? 1 : 0;
+    };
+
+    switch (column.type) {
+        case ColumnType::INTEGER: return compare_values(column.get_integer(position), extreme.parsed_value.integer);
+        case ColumnType::FLOAT: return compare_values(column.get_float(position), extreme.parsed_value.floating);
+        default: return compare_values(column.get_text(position), std::string_view(extreme.value));
+    }
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <optional>
+#include <string>
+
+#include "column.h"
+
+class ColumnSummary {
+public:
+    std::size_t null_count = 0;
+
+    auto add(const Column& column, std::size_t position) -> void;
+
+    auto remove(const Column& column, std::size_t position) -> void;
+
+    auto refresh(const Column& column) -> void;
+
+    auto rebuild(const Column& column) -> void;
+
+    auto clear() -> void;
+
+    [[nodiscard]] auto get_min() const -> std::string;
+
+    [[nodiscard]] auto get_max() const -> std::string;
+
+private:
+    struct Extreme {
+        ParsedValue parsed_value;
+        std::string value;
+    };
+
+    std::optional<Extreme> min;
+    std::optional<Extreme> max;
+    bool is_stale = false;
+
+    static auto make_extreme(const Column& column, std::size_t position) -> Extreme;
+
+    static auto compare(const Column& column, std::size_t position, const Extreme& extreme) -> int;
+};
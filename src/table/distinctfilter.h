@@ -0,0 +1,66 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+class DistinctFilter {
+public:
+    template <typename Hash, typename Equal>
+    static auto filter(std::vector<std::size_t>& rows, std::size_t max_rows, const Hash& hash, const Equal& equal) -> void;
+
+    [[nodiscard]] static auto get_table_bytes(std::size_t row_count, std::size_t max_rows) -> std::size_t;
+
+private:
+    static constexpr std::size_t empty_slot = std::numeric_limits<std::size_t>::max();
+    static constexpr std::size_t min_slot_count = 16;
+
+    struct Slot {
+        std::size_t fingerprint = 0;
+        std::size_t row = empty_slot;
+    };
+
+    [[nodiscard]] static auto get_slot_count(std::size_t row_count, std::size_t max_rows) -> std::size_t;
+};
+
+inline auto DistinctFilter::get_table_bytes(const std::size_t row_count, const std::size_t max_rows) -> std::size_t {
+    return get_slot_count(row_count, max_rows) * sizeof(Slot);
+}
+
+inline auto DistinctFilter::get_slot_count(const std::size_t row_count, const std::size_t max_rows) -> std::size_t {
+    return std::bit_ceil(std::max(std::min(row_count, max_rows) * 2, min_slot_count));
+}
+
+template <typename Hash, typename Equal>
+auto DistinctFilter::filter(std::vector<std::size_t>& rows, const std::size_t max_rows, const Hash& hash, const Equal& equal) -> void {
+    const auto slot_count = get_slot_count(rows.size(), max_rows);
+    const auto slot_shift = 64 - std::countr_zero(slot_count);
+
+    auto slots = std::vector<Slot>(slot_count);
+    auto kept_rows = std::size_t{0};
+
+    for (auto i = std::size_t{0}; i < rows.size() && kept_rows < max_rows; ++i) {
+        const auto row = rows[i];
+        const auto fingerprint = hash(row);
+        auto slot = static_cast<std::size_t>(static_cast<std::uint64_t>(fingerprint) * 0x9E3779B97F4A7C15ULL >> slot_shift);
+        auto is_duplicate = false;
+
+        while (slots[slot].row != empty_slot) {
+            if (slots[slot].fingerprint == fingerprint && equal(slots[slot].row, row)) {
+                is_duplicate = true;
+                break;
+            }
+
+            slot = (slot + 1) & (slot_count - 1);
+        }
+
+        if (is_duplicate) continue;
+
+        slots[slot] = {fingerprint, row};
+        rows[kept_rows++] = row;
+    }
+
+    rows.resize(kept_rows);
+}
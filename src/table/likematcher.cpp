@@ -0,0 +1,60 @@
+#include "likematcher.h"
+
+#include <algorithm>
+
+LikeMatcher::LikeMatcher(const std::string_view pattern) : pattern(pattern) {
+    if (pattern.find('_') != std::string_view::npos) return;
+
+    if (!pattern.empty() && std::ranges::all_of(pattern, [](const char c) { return c == '%'; })) {
+        kind = MatchKind::ANY;
+        return;
+    }
+
+    const auto starts_with_wildcard = pattern.starts_with('%');
+    const auto ends_with_wildcard = pattern.size() > static_cast<std::size_t>(starts_with_wildcard) && pattern.ends_with('%');
+    const auto inner = pattern.substr(starts_with_wildcard, pattern.size() - starts_with_wildcard - ends_with_wildcard);
+
+    if (inner.find('%') != std::string_view::npos) return;
+
+    literal = inner;
+
+    if (starts_with_wildcard && ends_with_wildcard) kind = MatchKind::CONTAINS;
+    else if (starts_with_wildcard) kind = MatchKind::SUFFIX;
+    else if (ends_with_wildcard) kind = MatchKind::PREFIX;
+    else kind = MatchKind::EXACT;
+}
+
+auto LikeMatcher::matches(const std::string_view value) const -> bool {
+    switch (kind) {
+        case MatchKind::ANY: return true;
+        case MatchKind::EXACT: return value == literal;
+        case MatchKind::PREFIX: return value.starts_with(literal);
+        case MatchKind::SUFFIX: return value.ends_with(literal);
+        case MatchKind::CONTAINS: return value.find(literal) != std::string_view::npos;
+        default: return matches_glob(value);
+    }
+}
+
+auto LikeMatcher::matches_glob(const std::string_view value) const -> bool {
+    auto value_index = std::size_t{0};
+    auto pattern_index = std::size_t{0};
+    auto wildcard_index = std::string::npos;
+    auto wildcard_value_index = std::size_t{0};
+
+    while (value_index < value.size()) {
+        if (pattern_index < pattern.size() && pattern[pattern_index] == '%') {
+            wildcard_index = pattern_index++;
+            wildcard_value_index = value_index;
+        } else if (pattern_index < pattern.size() && (pattern[pattern_index] == '_' || pattern[pattern_index] == value[value_index])) {
+            ++value_index;
+            ++pattern_index;
+        } else if (wildcard_index != std::string::npos) {
+            pattern_index = wildcard_index + 1;
+            value_index = ++wildcard_value_index;
+        } else return false;
+    }
+
+    while (pattern_index < pattern.size() && pattern[pattern_index] == '%') ++pattern_index;
+
+    return pattern_index == pattern.size();
+}
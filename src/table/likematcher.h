@@ -0,0 +1,27 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+
+class LikeMatcher {
+public:
+    explicit LikeMatcher(std::string_view pattern);
+
+    [[nodiscard]] auto matches(std::string_view value) const -> bool;
+
+private:
+    enum class MatchKind {
+        ANY,
+        EXACT,
+        PREFIX,
+        SUFFIX,
+        CONTAINS,
+        GLOB
+    };
+
+    MatchKind kind = MatchKind::GLOB;
+    std::string pattern;
+    std::string literal;
+
+    [[nodiscard]] auto matches_glob(std::string_view value) const -> bool;
+};
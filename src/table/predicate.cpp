@@ -0,0 +1,140 @@
+#include "predicate.h"
+
+Predicate::Predicate(
+    const Column& column,
+    const std::string& comparison_operator,
+    const std::string& value
+) : column(&column) {
+    if (comparison_operator == "LIKE") {
+        like_matcher.emplace(value);
+
+        if (column.dictionary_encoded) {
+            matching_codes.resize(column.dictionary.size());
+            for (auto code = std::size_t{0}; code < column.dictionary.size(); ++code) {
+                matching_codes[code] = like_matcher->matches(column.dictionary[code]);
+            }
+            kind = PredicateKind::CODES;
+        } else kind = PredicateKind::LIKE;
+
+        return;
+    }
+
+    const auto parsed_comparison = to_comparison(comparison_operator);
+    if (!parsed_comparison) return;
+
+    comparison = *parsed_comparison;
+    const auto is_equality = comparison == Comparison::EQUAL;
+    const auto is_inequality = comparison == Comparison::NOT_EQUAL;
+
+    if (column.type == ColumnType::INTEGER || column.type == ColumnType::FLOAT) {
+        if (value.empty() && (is_equality || is_inequality)) {
+            kind = PredicateKind::NULL_CHECK;
+            matches_nulls = is_equality;
+        } else if (column.type == ColumnType::INTEGER && Column::parse_integer(value, integer_value)) {
+            kind = PredicateKind::INTEGER;
+        } else if (Column::parse_float(value, float_value)) {
+            kind = column.type == ColumnType::INTEGER ? PredicateKind::INTEGER_AS_FLOAT : PredicateKind::FLOAT;
+        } else {
+            kind = is_inequality ? PredicateKind::ALL : PredicateKind::NONE;
+        }
+
+        return;
+    }
+
+    if (column.dictionary_encoded) {
+        if (is_equality || is_inequality) {
+            matching_codes.assign(column.dictionary.size(), is_inequality);
+            if (const auto code = column.find_code(value)) matching_codes[*code] = is_equality;
+        } else {
+            matching_codes.resize(column.dictionary.size());
+            for (auto code = std::size_t{0}; code < column.dictionary.size(); ++code) {
+                matching_codes[code] = compare(std::string_view(column.dictionary[code]), std::string_view(value));
+            }
+        }
+
+        kind = PredicateKind::CODES;
+        return;
+    }
+
+    text_value = value;
+    kind = PredicateKind::TEXT;
+}
+
+auto Predicate::matches(const std::size_t position) const -> bool {
+    switch (kind) {
+        case PredicateKind::ALL:
+            return true;
+        case PredicateKind::NULL_CHECK:
+            return column->nulls[position] == matches_nulls;
+        case PredicateKind::INTEGER:
+            if (column->nulls[position]) return comparison == Comparison::NOT_EQUAL;
+            return compare(column->integers[position], integer_value);
+        case PredicateKind::INTEGER_AS_FLOAT:
+            if (column->nulls[position]) return comparison == Comparison::NOT_EQUAL;
+            return compare(static_cast<double>(column->integers[position]), float_value);
+        case PredicateKind::FLOAT:
+            if (column->nulls[position]) return comparison == Comparison::NOT_EQUAL;
+            return compare(column->floats[position], float_value);
+        case PredicateKind::TEXT:
+            return compare(column->get_text(position), std::string_view(text_value));
+        case PredicateKind::CODES:
+            return matching_codes[column->codes[position]];
+        case PredicateKind::LIKE:
+            return column->type == ColumnType::TEXT ?
+                like_matcher->matches(column->get_text(position)) :
+                like_matcher->matches(column->get_value(position));
+        default:
+            return false;
+    }
+}
+
+auto Predicate::filter() const -> std::vector<std::size_t> {
+    auto positions = std::vector<std::size_t>{};
+    if (kind == PredicateKind::NONE) return positions;
+
+    const auto size = column->size();
+    for (auto position = std::size_t{0}; position < size; ++position) {
+        if (matches(position)) positions.push_back(position);
+    }
+
+    return positions;
+}
+
+auto Predicate::filter(const std::vector<std::size_t>& candidates) const -> std::vector<std::size_t> {
+    auto positions = std::vector<std::size_t>{};
+    if (kind == PredicateKind::NONE) return positions;
+    if (kind == PredicateKind::ALL) return candidates;
+
+    for (const auto position : candidates) {
+        if (matches(position)) positions.push_back(position);
+    }
+
+    return positions;
+}
+
+auto Predicate::is_valid_operator(const std::string& comparison_operator) -> bool {
+    return comparison_operator == "LIKE" || to_comparison(comparison_operator).has_value();
+}
+
+auto Predicate::to_comparison(const std::string& comparison_operator) -> std::optional<Comparison> {
+    if (comparison_operator == "=") return Comparison::EQUAL;
+    if (comparison_operator == "!=" || comparison_operator == "<>") return Comparison::NOT_EQUAL;
+    if (comparison_operator == ">") return Comparison::GREATER;
+    if (comparison_operator == ">=") return Comparison::GREATER_EQUAL;
+    if (comparison_operator == "<") return Comparison::LESS;
+    if (comparison_operator == "<=") return Comparison::LESS_EQUAL;
+
+    return std::nullopt;
+}
+
+template <typename T>
+auto Predicate::compare(const T& element, const T& value) const -> bool {
+    switch (comparison) {
+        case Comparison::EQUAL: return element == value;
+        case Comparison::NOT_EQUAL: return element != value;
+        case Comparison::GREATER: return element > value;
+        case Comparison::GREATER_EQUAL: return element >= value;
+        case Comparison::LESS: return element < value;
+        default: return element <= value;
+    }
+}
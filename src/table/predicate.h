@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "column.h"
+#include "likematcher.h"
+
+class Predicate {
+public:
+    Predicate() = default;
+
+    Predicate(const Column& column, const std::string& comparison_operator, const std::string& value);
+
+    [[nodiscard]] auto matches(std::size_t position) const -> bool;
+
+    [[nodiscard]] auto filter() const -> std::vector<std::size_t>;
+
+    [[nodiscard]] auto filter(const std::vector<std::size_t>& candidates) const -> std::vector<std::size_t>;
+
+    static auto is_valid_operator(const std::string& comparison_operator) -> bool;
+
+private:
+    enum class PredicateKind {
+        NONE,
+        ALL,
+        NULL_CHECK,
+        INTEGER,
+        INTEGER_AS_FLOAT,
+        FLOAT,
+        TEXT,
+        CODES,
+        LIKE
+    };
+
+    enum class Comparison {
+        EQUAL,
+        NOT_EQUAL,
+        GREATER,
+        GREATER_EQUAL,
+        LESS,
+        LESS_EQUAL
+    };
+
+    const Column* column = nullptr;
+    PredicateKind kind = PredicateKind::NONE;
+    Comparison comparison = Comparison::EQUAL;
+    bool matches_nulls = false;
+    std::int64_t integer_value = 0;
+    double float_value = 0.0;
+    std::string text_value;
+    std::vector<bool> matching_codes;
+    std::optional<LikeMatcher> like_matcher;
+
+    static auto to_comparison(const std::string& comparison_operator) -> std::optional<Comparison>;
+
+    template <typename T>
+    [[nodiscard]] auto compare(const T& element, const T& value) const -> bool;
+};
@@ -0,0 +1,43 @@
+#include "rowsorter.h"
+
+auto RowSorter::sort(std::vector<std::size_t>& positions, const std::size_t row_bound) const -> void {
+    sort(positions, row_bound, [](const std::size_t position, std::size_t) {
+        return std::optional<std::size_t>{position};
+    });
+}
+
+auto RowSorter::sort(
+    std::vector<std::size_t>& rows,
+    const std::vector<std::vector<std::optional<std::size_t>>>& joined_rows,
+    const std::size_t row_bound
+) const -> void {
+    sort(rows, row_bound, [&](const std::size_t row, const std::size_t table_index) {
+        return joined_rows[row][table_index];
+    });
+}
+
+auto RowSorter::compare_values(
+    const Column& column,
+    const std::optional<std::size_t> position,
+    const std::optional<std::size_t> other_position
+) -> int {
+    const auto compare = [](const auto& value, const auto& other_value) {
+        return value < other_value ? -1 : other_value < value ? 1 : 0;
+    };
+
+    const auto is_null = !position || column.is_null(*position);
+    const auto is_other_null = !other_position || column.is_null(*other_position);
+    if (is_null || is_other_null) return compare(!is_null, !is_other_null);
+
+    switch (column.type) {
+        case ColumnType::INTEGER: return compare(column.get_integer(*position), column.get_integer(*other_position));
+        case ColumnType::FLOAT: return compare(column.get_float(*position), column.get_float(*other_position));
+        default: return compare(column.get_text(*position), column.get_text(*other_position));
+    }
+}
+
+auto RowSorter::get_buffer_bytes(const std::size_t row_count, const std::size_t row_bound) -> std::size_t {
+    if (row_bound < row_count) return row_bound * sizeof(std::size_t);
+
+    return row_count < parallel_sort_min_rows ? 0 : row_count * sizeof(std::size_t);
+}
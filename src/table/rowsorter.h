@@ -0,0 +1,122 @@
+#pragma once
+
+#include <algorithm>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include "column.h"
+
+class RowSorter {
+public:
+    struct SortKey {
+        const Column* column = nullptr;
+        std::size_t table_index = 0;
+        bool is_descending = false;
+    };
+
+    explicit RowSorter(std::vector<SortKey> keys) : keys(std::move(keys)) {}
+
+    auto sort(std::vector<std::size_t>& positions, std::size_t row_bound) const -> void;
+
+    auto sort(
+        std::vector<std::size_t>& rows,
+        const std::vector<std::vector<std::optional<std::size_t>>>& joined_rows,
+        std::size_t row_bound
+    ) const -> void;
+
+    template <typename PositionOf>
+    auto sort(std::vector<std::size_t>& rows, std::size_t row_bound, const PositionOf& position_of) const -> void;
+
+    static auto compare_values(
+        const Column& column,
+        std::optional<std::size_t> position,
+        std::optional<std::size_t> other_position
+    ) -> int;
+
+    [[nodiscard]] static auto get_buffer_bytes(std::size_t row_count, std::size_t row_bound) -> std::size_t;
+
+private:
+    static constexpr std::size_t parallel_sort_min_rows = std::size_t{1} << 16;
+
+    std::vector<SortKey> keys;
+
+    template <typename Less>
+    static auto sort_rows(std::vector<std::size_t>& rows, std::size_t row_bound, const Less& less) -> void;
+
+    template <typename Less>
+    static auto parallel_sort(std::vector<std::size_t>& rows, const Less& less) -> void;
+};
+
+template <typename PositionOf>
+auto RowSorter::sort(std::vector<std::size_t>& rows, const std::size_t row_bound, const PositionOf& position_of) const -> void {
+    sort_rows(rows, row_bound, [&](const std::size_t row, const std::size_t other_row) {
+        for (const auto& key : keys) {
+            const auto comparison = compare_values(*key.column, position_of(row, key.table_index), position_of(other_row, key.table_index));
+            if (comparison != 0) return key.is_descending ? comparison > 0 : comparison < 0;
+        }
+
+        return row < other_row;
+    });
+}
+
+template <typename Less>
+auto RowSorter::sort_rows(std::vector<std::size_t>& rows, const std::size_t row_bound, const Less& less) -> void {
+    if (row_bound >= rows.size()) {
+        if (rows.size() < parallel_sort_min_rows) std::ranges::sort(rows, less);
+        else parallel_sort(rows, less);
+
+        return;
+    }
+
+    auto heap = std::vector<std::size_t>{};
+    heap.reserve(row_bound);
+
+    for (const auto row : rows) {
+        if (heap.size() < row_bound) {
+            heap.push_back(row);
+            std::ranges::push_heap(heap, less);
+        } else if (!heap.empty() && less(row, heap.front())) {
+            std::ranges::pop_heap(heap, less);
+            heap.back() = row;
+            std::ranges::push_heap(heap, less);
+        }
+    }
+
+    std::ranges::sort_heap(heap, less);
+    rows = std::move(heap);
+}
+
+template <typename Less>
+auto RowSorter::parallel_sort(std::vector<std::size_t>& rows, const Less& less) -> void {
+    const auto thread_count = std::min<std::size_t>(std::max(std::thread::hardware_concurrency(), 1u), rows.size() / parallel_sort_min_rows);
+
+    auto bounds = std::vector<std::size_t>{};
+    for (auto i = std::size_t{0}; i <= thread_count; ++i) bounds.push_back(rows.size() * i / thread_count);
+
+    {
+        auto threads = std::vector<std::jthread>{};
+
+        for (auto i = std::size_t{0}; i < thread_count; ++i) {
+            threads.emplace_back([&, i] { std::sort(rows.begin() + bounds[i], rows.begin() + bounds[i + 1], less); });
+        }
+    }
+
+    while (bounds.size() > 2) {
+        auto merged_bounds = std::vector<std::size_t>{0};
+
+        {
+            auto threads = std::vector<std::jthread>{};
+
+            for (auto i = std::size_t{2}; i < bounds.size(); i += 2) {
+                threads.emplace_back([&, i] {
+                    std::inplace_merge(rows.begin() + bounds[i - 2], rows.begin() + bounds[i - 1], rows.begin() + bounds[i], less);
+                });
+                merged_bounds.push_back(bounds[i]);
+            }
+        }
+
+        if (bounds.size() % 2 == 0) merged_bounds.push_back(bounds.back());
+        bounds = std::move(merged_bounds);
+    }
+}
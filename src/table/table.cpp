@@ -1,4 +1,5 @@
 #include <fmt/ranges.h>
+#include <numeric>
 
 #include "table.h"
 #include "../constraintchecker/constraintchecker.h"
@@ -12,116 +13,126 @@ auto Table::insert_row(const std::vector<std::string>& data) -> void {
 
     if (!ConstraintChecker::check_data(data, *this)) return;
 
+    auto parsed_values = std::vector<ParsedValue>(column_names.size());
+
     for (int i = 0; i < column_names.size(); i++) {
-        if (!validate_value(data.at(i), column_types.at(i), column_names.at(i))) return;
+        if (!validate_value(data.at(i), column_types.at(i), column_names.at(i), parsed_values.at(i))) return;
     }
 
-    rows.push_back(data);
+    append_row(data, parsed_values);
 
     fmt::println("Successfully inserted data into table: '{}'", name);
 }
 
-auto Table::get_all_data() const -> std::vector<std::vector<std::string> > {
-    return rows;
+auto Table::insert_rows(const std::vector<std::vector<std::string>>& rows) -> std::size_t {
+    auto fields = std::vector<std::string_view>{};
+    fields.reserve(rows.size() * column_names.size());
+
+    for (const auto& row : rows) {
+        if (row.size() != column_names.size()) {
+            fmt::println("Row size does not match the number of columns!");
+            return 0;
+        }
+
+        fields.insert(fields.end(), row.begin(), row.end());
+    }
+
+    return insert_rows(fields);
 }
 
-auto Table::get_all_data_from(const std::vector<std::string>& column_names, const std::vector<std::vector<std::string>>& rows) const -> std::vector<std::vector<std::string>> {
+auto Table::insert_rows(const std::vector<std::string_view>& fields) -> std::size_t {
+    if (column_names.empty() || fields.size() % column_names.size() != 0) {
+        fmt::println("Row size does not match the number of columns!");
+        return 0;
+    }
+
+    const auto rows_number = fields.size() / column_names.size();
+    auto batch_columns = std::vector<Column>{};
+    batch_columns.reserve(column_names.size());
 
-    const auto& effective_column_names = column_names.size() == 1 && column_names.at(0) == "*" ?
-        this->column_names :
-        column_names;
+    for (int i = 0; i < column_names.size(); i++) {
+        auto& batch_column = batch_columns.emplace_back(column_types.at(i));
 
-    auto data = std::vector<std::vector<std::string>>{};
+        for (auto row = std::size_t{0}; row < rows_number; ++row) {
+            const auto value = fields[row * column_names.size() + i];
+            auto parsed_value = ParsedValue{};
 
-    for (auto row : rows) {
-        auto data_from_row = std::vector<std::string>{};
-        for (auto column_name : effective_column_names) {
-            std::erase(column_name, ',');
+            if (!validate_value(value, column_types.at(i), column_names.at(i), parsed_value)) return 0;
 
-            if (const auto dot_pos = column_name.find('.'); dot_pos != std::string::npos) {
-                const auto [tab, col] = split_string_with_dot(column_name);
-                const auto column_index = find_index(this->column_names, col);
+            batch_column.push_back(value, parsed_value);
+        }
+    }
 
-                if (tab != this->name || column_index == -1) {
-                    data_from_row.emplace_back("");
-                    continue;
-                }
+    if (!ConstraintChecker::check_columns(batch_columns, *this)) return 0;
 
-                data_from_row.push_back(row.at(column_index));
-                continue;
-            }
+    const auto first_position = row_count();
 
-            const auto column_index = find_index(this->column_names, column_name);
-            if (column_index == -1) {
-                data_from_row.emplace_back("");
-                continue;
-            }
+    for (int i = 0; i < column_names.size(); i++) columns.at(i).append(batch_columns.at(i));
+    for (auto row = std::size_t{0}; row < rows_number; ++row) row_ids.push_back(next_row_id++);
 
-            data_from_row.push_back(row.at(column_index));
+    for (int i = 0; i < column_names.size(); i++) {
+        for (auto position = first_position; position < row_count(); ++position) {
+            if (unique_indexes.at(i)) unique_indexes.at(i)->insert(columns.at(i), position, row_ids.at(position));
+            if (ordered_indexes.at(i)) ordered_indexes.at(i)->insert(columns.at(i), position, row_ids.at(position));
+            column_summaries.at(i).add(columns.at(i), position);
         }
-        data.push_back(data_from_row);
     }
 
-    return data;
+    return rows_number;
 }
 
-auto Table::get_data_filtered_by(
-    const std::string& comparison_operator,
-    const std::vector<std::vector<std::string>>& data,
-    const std::vector<std::string>& column_names,
-    const std::string& condition_column_name,
-    const std::string& condition_column_value
-) const -> std::vector<std::vector<std::string>> {
-    const auto& effective_column_names = column_names.size() == 1 && column_names.at(0) == "*" ?
-        this->column_names :
-        column_names;
-
-    if (comparison_operator == "=")
-        return filter_data(data, effective_column_names, condition_column_name, [&](const std::string& value, int) {
-            return value == condition_column_value;
-        });
-
-    if (comparison_operator == "!=" || comparison_operator == "<>")
-        return filter_data(data, effective_column_names, condition_column_name, [&](const std::string& value, int) {
-            return value != condition_column_value;
-        });
-
-    if (comparison_operator == "!=")
-        return filter_data(data, effective_column_names, condition_column_name, [&](const std::string& value, int) {
-            return value != condition_column_value;
-        });
-
-    if (comparison_operator == ">")
-        return filter_data(data, effective_column_names, condition_column_name, [&](const std::string& value, const int index) {
-            if (column_types.size() - 1 >= index) return compare_values(value, condition_column_value, column_types.at(index)) > 0;
-            return false;
-        });
+auto Table::append_row(const std::vector<std::string>& data, const std::vector<ParsedValue>& parsed_values) -> void {
+    for (int i = 0; i < column_names.size(); i++) {
+        columns.at(i).push_back(data.at(i), parsed_values.at(i));
+        if (unique_indexes.at(i)) unique_indexes.at(i)->insert(columns.at(i), columns.at(i).size() - 1, next_row_id);
+        if (ordered_indexes.at(i)) ordered_indexes.at(i)->insert(columns.at(i), columns.at(i).size() - 1, next_row_id);
+        column_summaries.at(i).add(columns.at(i), columns.at(i).size() - 1);
+    }
+    row_ids.push_back(next_row_id++);
+}
 
-    if (comparison_operator == ">=")
-        return filter_data(data, effective_column_names, condition_column_name, [&](const std::string& value, const int index) {
-            if (column_types.size() - 1 >= index) return compare_values(value, condition_column_value, column_types.at(index)) >= 0;
-            return false;
-        });
+auto Table::row_count() const -> std::size_t {
+    return columns.empty() ? 0 : columns.front().size();
+}
 
-    if (comparison_operator == "<")
-        return filter_data(data, effective_column_names, condition_column_name, [&](const std::string& value, const int index) {
-            if (column_types.size() - 1 >= index) return compare_values(value, condition_column_value, column_types.at(index)) < 0;
-            return false;
-        });
+auto Table::get_row(const std::size_t position) const -> std::vector<std::string> {
+    auto row = std::vector<std::string>{};
+    row.reserve(columns.size());
 
-    if (comparison_operator == "<=")
-        return filter_data(data, effective_column_names, condition_column_name, [&](const std::string& value, const int index) {
-            if (column_types.size() - 1 >= index) return compare_values(value, condition_column_value, column_types.at(index)) <= 0;
-            return false;
-        });
+    for (const auto& column : columns) row.push_back(column.get_value(position));
+
+    return row;
+}
 
-    if (comparison_operator == "LIKE")
-        return filter_data(data, effective_column_names, condition_column_name, [&](const std::string& value, int) {
-            return matches_pattern(value, condition_column_value);
-        });
+auto Table::positions() const -> std::ranges::iota_view<std::size_t, std::size_t> {
+    return std::views::iota(std::size_t{0}, row_count());
+}
+
+auto Table::get_data_from(const std::vector<int>& column_indices) const -> std::vector<std::vector<std::string>> {
+    auto all_positions = std::vector<std::size_t>(row_count());
+    std::iota(all_positions.begin(), all_positions.end(), std::size_t{0});
 
-    fmt::println("Invalid comparison operator: {}", comparison_operator);
-    return {};
+    return get_data_from(column_indices, all_positions);
+}
+
+auto Table::get_data_from(
+    const std::vector<int>& column_indices,
+    const std::vector<std::size_t>& positions
+) const -> std::vector<std::vector<std::string>> {
+    auto data = std::vector<std::vector<std::string>>(positions.size());
+    for (auto& row : data) row.reserve(column_indices.size());
+
+    for (const auto column_index : column_indices) {
+        if (column_index == -1) {
+            for (auto& row : data) row.emplace_back("");
+            continue;
+        }
+
+        const auto& column = columns[column_index];
+        for (auto i = std::size_t{0}; i < positions.size(); ++i) data[i].push_back(column.get_value(positions[i]));
+    }
+
+    return data;
 }
 
 auto Table::find_index(const std::vector<std::string> &vec, const std::string &value) -> int {
@@ -152,7 +163,14 @@ auto Table::add_column(
     column_constraints.push_back(new_column_constraints);
     column_foreign_keys.push_back(new_column_foreign_key);
 
-    for (auto& row : rows) row.emplace_back("");
+    const auto rows_number = row_count();
+    auto& column = columns.emplace_back(column_type);
+    for (auto i = std::size_t{0}; i < rows_number; ++i) column.push_null();
+
+    unique_indexes.emplace_back();
+    ordered_indexes.emplace_back();
+    column_summaries.emplace_back().rebuild(column);
+    if (has_unique_constraint(static_cast<int>(columns.size()) - 1)) unique_indexes.back().emplace(column_type);
 
     fmt::println("Successfully added column with name: '{}' to table with name name: '{}'", column_name, name);
 }
@@ -170,12 +188,117 @@ auto Table::remove_column(const std::string &column_name) -> void {
     column_types.erase(column_types.begin() + column_index);
     column_constraints.erase(column_constraints.begin() + column_index);
     column_foreign_keys.erase(column_foreign_keys.begin() + column_index);
-
-    for (auto& row : rows) row.erase(row.begin() + column_index);
+    columns.erase(columns.begin() + column_index);
+    unique_indexes.erase(unique_indexes.begin() + column_index);
+    ordered_indexes.erase(ordered_indexes.begin() + column_index);
+    column_summaries.erase(column_summaries.begin() + column_index);
 
     fmt::println("Successfully removed column with name: '{}' from table with name name: '{}'", column_name, name);
 }
 
+auto Table::create_unique_index(const int column_index) -> bool {
+    auto index = HashIndex(column_types.at(column_index));
+
+    if (!index.build(columns.at(column_index), row_ids)) {
+        fmt::println("Column with name '{}' contains duplicated values!", column_names.at(column_index));
+        return false;
+    }
+
+    unique_indexes.at(column_index) = std::move(index);
+    return true;
+}
+
+auto Table::create_ordered_index(const std::string& column_name) -> void {
+    const auto column_index = find_index(column_names, column_name);
+
+    if (column_index == -1) {
+        fmt::println("Column with name '{}' not found in table with name: '{}'", column_name, name);
+        return;
+    }
+
+    if (ordered_indexes.at(column_index)) {
+        fmt::println("Column with name '{}' already has an index!", column_name);
+        return;
+    }
+
+    auto& index = ordered_indexes.at(column_index).emplace(column_types.at(column_index));
+    index.build(columns.at(column_index), row_ids);
+
+    fmt::println("Successfully created index on column '{}' in table '{}'", column_name, name);
+}
+
+auto Table::drop_ordered_index(const std::string& column_name) -> void {
+    const auto column_index = find_index(column_names, column_name);
+
+    if (column_index == -1) {
+        fmt::println("Column with name '{}' not found in table with name: '{}'", column_name, name);
+        return;
+    }
+
+    if (!ordered_indexes.at(column_index)) {
+        fmt::println("Column with name '{}' has no index!", column_name);
+        return;
+    }
+
+    ordered_indexes.at(column_index).reset();
+
+    fmt::println("Successfully dropped index on column '{}' in table '{}'", column_name, name);
+}
+
+auto Table::create_dictionary(const std::string& column_name) -> void {
+    const auto column_index = find_index(column_names, column_name);
+
+    if (column_index == -1) {
+        fmt::println("Column with name '{}' not found in table with name: '{}'", column_name, name);
+        return;
+    }
+
+    if (column_types.at(column_index) != ColumnType::TEXT) {
+        fmt::println("Only TEXT columns can be dictionary encoded!");
+        return;
+    }
+
+    if (columns.at(column_index).is_dictionary_encoded()) {
+        fmt::println("Column with name '{}' is already dictionary encoded!", column_name);
+        return;
+    }
+
+    columns.at(column_index).encode_dictionary();
+
+    fmt::println("Successfully created dictionary on column '{}' in table '{}'", column_name, name);
+}
+
+auto Table::drop_dictionary(const std::string& column_name) -> void {
+    const auto column_index = find_index(column_names, column_name);
+
+    if (column_index == -1) {
+        fmt::println("Column with name '{}' not found in table with name: '{}'", column_name, name);
+        return;
+    }
+
+    if (!columns.at(column_index).is_dictionary_encoded()) {
+        fmt::println("Column with name '{}' is not dictionary encoded!", column_name);
+        return;
+    }
+
+    columns.at(column_index).decode_dictionary();
+
+    fmt::println("Successfully dropped dictionary on column '{}' in table '{}'", column_name, name);
+}
+
+auto Table::has_unique_constraint(const int column_index) const -> bool {
+    const auto& constraints = column_constraints.at(column_index);
+
+    return std::ranges::find(constraints, Constraint::PRIMARY_KEY) != constraints.end() ||
+        std::ranges::find(constraints, Constraint::UNIQUE) != constraints.end();
+}
+
+auto Table::is_indexed(const std::string& column_name) const -> bool {
+    const auto column_index = resolve_column_index(column_name);
+
+    return column_index != -1 && (unique_indexes.at(column_index) || ordered_indexes.at(column_index));
+}
+
 auto Table::update_all_rows(const std::string& column_name, const std::string& new_value) -> void {
 
     const auto column_index = find_index(column_names, column_name);
@@ -185,35 +308,29 @@ auto Table::update_all_rows(const std::string& column_name, const std::string& n
         return;
     }
 
-    if (!validate_value(new_value, column_types.at(column_index), column_names.at(column_index))) {
+    auto parsed_value = ParsedValue{};
+
+    if (!validate_value(new_value, column_types.at(column_index), column_names.at(column_index), parsed_value)) {
         return;
     }
 
-    if (std::ranges::find(column_constraints.at(column_index), Constraint::PRIMARY_KEY) != column_constraints.at(column_index).end() ||
-        std::ranges::find(column_constraints.at(column_index), Constraint::UNIQUE) != column_constraints.at(column_index).end()) {
+    if (has_unique_constraint(column_index)) {
         fmt::println("Column with name '{}' has constraints, which protects against this operation!", column_name);
         return;
     }
 
-    for (auto& row : rows) row[column_index] = new_value;
+    columns.at(column_index).set_all(new_value, parsed_value);
+    if (ordered_indexes.at(column_index)) ordered_indexes.at(column_index)->build(columns.at(column_index), row_ids);
+    column_summaries.at(column_index).rebuild(columns.at(column_index));
 
     fmt::println("Successfully updated column '{}' in all rows in table '{}'", column_name, name);
 }
 
 auto Table::update_specific_rows(
-    const std::vector<std::vector<std::string>> &specific_rows,
+    const std::vector<std::size_t> &specific_row_ids,
     const std::vector<std::vector<std::string>> &columns_and_new_values
 ) -> void {
-    auto rows_to_update = std::vector<int>{};
-
-    for (auto i = 0; i < rows.size(); ++i) {
-        for (const auto& specific_row : specific_rows) {
-            if (rows[i] == specific_row) {
-                rows_to_update.push_back(i);
-                break;
-            }
-        }
-    }
+    const auto rows_to_update = find_positions(specific_row_ids);
 
     for (const auto& column_and_new_value : columns_and_new_values) {
         const auto& column_name = column_and_new_value.at(0);
@@ -225,76 +342,78 @@ auto Table::update_specific_rows(
             return;
         }
 
-        if (!validate_value(new_value, column_types.at(column_index), column_names.at(column_index))) {
+        auto parsed_value = ParsedValue{};
+
+        if (!validate_value(new_value, column_types.at(column_index), column_names.at(column_index), parsed_value)) {
             continue;
         }
 
-        if (std::ranges::find(column_constraints.at(column_index), Constraint::PRIMARY_KEY) != column_constraints.at(column_index).end() ||
-            std::ranges::find(column_constraints.at(column_index), Constraint::UNIQUE) != column_constraints.at(column_index).end()) {
+        if (has_unique_constraint(column_index)) {
             fmt::println("Column with name '{}' has constraints, which protects against this operation!", column_name);
             return;
         }
 
-        for (const auto& row_index : rows_to_update) rows[row_index][column_index] = new_value;
+        auto& index = ordered_indexes.at(column_index);
+        auto& summary = column_summaries.at(column_index);
+
+        for (const auto position : rows_to_update) {
+            if (index) index->erase(columns.at(column_index), position, row_ids.at(position));
+            summary.remove(columns.at(column_index), position);
+        }
+
+        columns.at(column_index).set(rows_to_update, new_value, parsed_value);
+
+        for (const auto position : rows_to_update) {
+            if (index) index->insert(columns.at(column_index), position, row_ids.at(position));
+            summary.add(columns.at(column_index), position);
+        }
+
+        summary.refresh(columns.at(column_index));
     }
 
     fmt::println("Successfully updated specific rows in table '{}'", name);
 }
 
 auto Table::delete_all_rows() -> void {
-    rows.clear();
+    for (auto& column : columns) column.clear();
+    for (auto& index : unique_indexes) {
+        if (index) index->clear();
+    }
+    for (auto& index : ordered_indexes) {
+        if (index) index->clear();
+    }
+    for (auto& summary : column_summaries) summary.clear();
+    row_ids.clear();
     fmt::println("Successfully deleted all rows from table '{}'", name);
 }
 
 auto Table::delete_specific_rows(
-    const std::vector<std::vector<std::string>> &specific_rows
+    const std::vector<std::size_t> &specific_row_ids
 ) -> void {
-    std::erase_if(rows, [&](const std::vector<std::string>& row) {
-            return std::ranges::any_of(specific_rows, [&](const std::vector<std::string>& specific_row) {
-                return row == specific_row;
-            });
+    auto erased_positions = std::vector<bool>(row_count());
+    for (const auto position : find_positions(specific_row_ids)) {
+        if (erased_positions[position]) continue;
+        erased_positions[position] = true;
+
+        for (int i = 0; i < columns.size(); i++) {
+            if (unique_indexes.at(i)) unique_indexes.at(i)->erase(columns.at(i), position);
+            if (ordered_indexes.at(i)) ordered_indexes.at(i)->erase(columns.at(i), position, row_ids.at(position));
+            column_summaries.at(i).remove(columns.at(i), position);
         }
-    );
-
-    fmt::println("Successfully deleted specific rows from table '{}'", name);
-}
-
-auto Table::compare_values(
-    const std::string& value1,
-    const std::string& value2,
-    const ColumnType& type) -> int {
-
-    if (type == ColumnType::INTEGER || type == ColumnType::FLOAT) {
-        if (value1.empty() || value2.empty()) {
-            return 0;
-        }
-
-        const double num1 = std::stod(value1);
-        const double num2 = std::stod(value2);
-
-        if (num1 > num2) return 1;
-        if (num1 < num2) return -1;
-
-        return 0;
     }
 
-    if (type == ColumnType::TEXT) {
-
-        if (value1 > value2) return 1;
-        if (value1 < value2) return -1;
-
-        return 0;
+    for (int i = 0; i < columns.size(); i++) {
+        columns.at(i).erase(erased_positions);
+        column_summaries.at(i).refresh(columns.at(i));
     }
 
-    return 0;
-}
-
-auto Table::matches_pattern(const std::string& value, const std::string& pattern) -> bool {
-    auto regex_pattern = std::regex_replace(pattern, std::regex(R"(\%)"), ".*");
-    regex_pattern = std::regex_replace(regex_pattern, std::regex(R"(\_)"), ".");
-    const auto regex = std::regex(regex_pattern);
+    auto kept = std::size_t{0};
+    for (auto i = std::size_t{0}; i < row_ids.size(); ++i) {
+        if (!erased_positions[i]) row_ids[kept++] = row_ids[i];
+    }
+    row_ids.resize(kept);
 
-    return std::regex_match(value, regex);
+    fmt::println("Successfully deleted specific rows from table '{}'", name);
 }
 
 auto Table::validate_column_index_and_value(
@@ -311,7 +430,7 @@ auto Table::validate_column_index_and_value(
         return false;
     }
 
-    if (!validate_value(new_value, column_types.at(column_index), column_names.at(column_index))) {
+    if (auto parsed_value = ParsedValue{}; !validate_value(new_value, column_types.at(column_index), column_names.at(column_index), parsed_value)) {
         return false;
     }
 
@@ -321,14 +440,14 @@ auto Table::validate_column_index_and_value(
 auto Table::validate_constraints(
     const std::string& column_name,
     int column_index,
-    const std::vector<std::string>& row,
+    const std::size_t position,
     const std::string& new_value
 ) -> bool {
 
+    const auto& index = unique_indexes.at(column_index);
+
     if (std::ranges::find(column_constraints.at(column_index), Constraint::PRIMARY_KEY) != column_constraints.at(column_index).end()) {
-        const auto duplicate_found = std::ranges::any_of(rows, [&](const auto& other_row) {
-            return other_row[column_index] == new_value;
-        });
+        const auto duplicate_found = index && index->contains(new_value);
 
         if (duplicate_found) {
             fmt::println("Cannot update column '{}'! Value '{}' violates PRIMARY_KEY constraint!", column_name, new_value);
@@ -337,9 +456,8 @@ auto Table::validate_constraints(
     }
 
     if (std::ranges::find(column_constraints.at(column_index), Constraint::UNIQUE) != column_constraints.at(column_index).end()) {
-        const auto duplicate_found = std::ranges::any_of(rows, [&](const auto& other_row) {
-            return &other_row != &row && other_row[column_index] == new_value;
-        });
+        const auto row_id = index ? index->find(new_value) : std::nullopt;
+        const auto duplicate_found = row_id && *row_id != row_ids.at(position);
 
         if (duplicate_found) {
             fmt::println("Cannot update column '{}'! Value '{}' violates UNIQUE constraint!", column_name, new_value);
@@ -351,87 +469,127 @@ auto Table::validate_constraints(
 }
 
 auto Table::validate_value(
-    const std::string& value,
+    const std::string_view value,
     const ColumnType& column_type,
-    const std::string& column_name
+    const std::string& column_name,
+    ParsedValue& parsed_value
 ) -> bool {
 
-    const std::regex integer_regex(R"(^[-+]?[0-9]+$)");
-    const std::regex float_regex(R"(^[-+]?[0-9]*\.?[0-9]+([eE][-+]?[0-9]+)?$)");
-
-    switch (column_type) {
-        case ColumnType::INTEGER: {
-            if (!std::regex_match(value, integer_regex)) {
-                fmt::println("Value '{}' in column '{}' is not a valid INTEGER!", value, column_name);
-                return false;
-            }
-        } break;
-
-        case ColumnType::FLOAT: {
-            if (!std::regex_match(value, float_regex)) {
-                fmt::println("Value '{}' in column '{}' is not a valid FLOAT!", value, column_name);
-                return false;
-            }
-        } break;
-
-        case ColumnType::TEXT:
+    switch (Column::parse_value(value, column_type, parsed_value)) {
+        case ParseResult::INVALID: {
+            fmt::println("Value '{}' in column '{}' is not a valid {}!", value, column_name, column_type_to_string(column_type));
+            return false;
+        }
+
+        case ParseResult::OUT_OF_RANGE: {
+            fmt::println("Value '{}' in column '{}' is out of {} range!", value, column_name, column_type_to_string(column_type));
+            return false;
+        }
+
+        case ParseResult::VALID:
             break;
     }
 
     return true;
 }
 
-auto Table::find_indices(const std::vector<std::string>& vec, const std::string& value) const -> std::vector<int> {
-    auto indices = std::vector<int>{};
+auto Table::resolve_column_index(const std::string& column_name) const -> int {
+    const auto dot_position = column_name.find('.');
+    if (dot_position == std::string::npos) return find_index(column_names, column_name);
 
-    for (int i = 0; i < vec.size(); ++i) {
-        auto element = vec[i];
-        std::erase(element, ',');
-
-        if (const auto dot_pos = value.find('.'); dot_pos != std::string::npos) {
-            if (element.find('.') != std::string::npos && element == value) indices.push_back(i);
-            if (element.find('.') == std::string::npos) {
-                const auto [left, right] = split_string_with_dot(value);
-                if (left == this->name && right == element) indices.push_back(i);
-            }
-            continue;
-        }
+    if (std::string_view(column_name).substr(0, dot_position) != name) return -1;
+
+    return find_index(column_names, column_name.substr(dot_position + 1));
+}
+
+auto Table::get_positions_filtered_by(
+    const std::string& comparison_operator,
+    const std::string& condition_column_name,
+    const std::string& condition_column_value
+) const -> std::vector<std::size_t> {
+    const auto column_index = resolve_column_index(condition_column_name);
+
+    if (column_index == -1) return {};
+
+    const auto& column = columns.at(column_index);
+    const auto access_path = get_access_path(comparison_operator, condition_column_name, condition_column_value);
 
-        const auto [left, right] = split_string_with_dot(element);
+    if (access_path == AccessPath::UNIQUE_INDEX) {
+        const auto row_id = unique_indexes.at(column_index)->find(condition_column_value);
+        if (!row_id) return {};
 
-        if (right == value) indices.push_back(i);
+        return find_positions({*row_id});
     }
 
-    return indices;
+    if (access_path == AccessPath::ORDERED_INDEX) {
+        if (const auto specific_row_ids = ordered_indexes.at(column_index)->find(comparison_operator, condition_column_value)) {
+            return find_positions(*specific_row_ids);
+        }
+    }
+
+    if (!Predicate::is_valid_operator(comparison_operator)) {
+        fmt::println("Invalid comparison operator: {}", comparison_operator);
+        return {};
+    }
+
+    return Predicate(column, comparison_operator, condition_column_value).filter();
 }
 
-auto Table::filter_data(
-    const std::vector<std::vector<std::string>> &data,
-    const std::vector<std::string> &column_names,
-    const std::string &condition_column_name,
-    const std::function<bool(const std::string&, int)> &condition
-) const -> std::vector<std::vector<std::string>> {
-    auto filtered_data = std::vector<std::vector<std::string>>{};
-    const auto condition_column_indices = find_indices(column_names, condition_column_name);
+auto Table::get_access_path(
+    const std::string& comparison_operator,
+    const std::string& condition_column_name,
+    const std::string& condition_column_value
+) const -> AccessPath {
+    const auto column_index = resolve_column_index(condition_column_name);
+    if (column_index == -1) return AccessPath::FULL_SCAN;
 
-    if (condition_column_indices.empty()) return {};
+    auto parsed_value = ParsedValue{};
+    if (Column::parse_value(condition_column_value, columns.at(column_index).type, parsed_value) != ParseResult::VALID) return AccessPath::FULL_SCAN;
+
+    if (comparison_operator == "=" && unique_indexes.at(column_index) && !condition_column_value.empty()) return AccessPath::UNIQUE_INDEX;
+    if (ordered_indexes.at(column_index) && OrderedIndex::is_supported_operator(comparison_operator)) return AccessPath::ORDERED_INDEX;
+
+    return AccessPath::FULL_SCAN;
+}
 
-    for (const auto& row : data) {
-        for (const auto& index : condition_column_indices) {
-            if (condition(row[index], index)) {
-                filtered_data.push_back(row);
-                break;
-            }
+auto Table::get_positions_ordered_by(const int column_index) const -> std::optional<std::vector<std::size_t>> {
+    if (!ordered_indexes.at(column_index)) return std::nullopt;
+
+    const auto& column = columns.at(column_index);
+    auto ordered_positions = std::vector<std::size_t>{};
+    ordered_positions.reserve(row_count());
+
+    if (column.type != ColumnType::TEXT) {
+        for (auto i = std::size_t{0}; i < column.size(); ++i) {
+            if (column.is_null(i)) ordered_positions.push_back(i);
         }
     }
 
-    return filtered_data;
+    const auto indexed_positions = find_positions(ordered_indexes.at(column_index)->get_ordered_row_ids());
+    ordered_positions.insert(ordered_positions.end(), indexed_positions.begin(), indexed_positions.end());
+
+    return ordered_positions;
 }
 
-auto Table::split_string_with_dot(const std::string &str) -> std::pair<std::string, std::string> {
-    const auto dot_pos = str.find('.');
-    auto left = str.substr(0, dot_pos);
-    auto right = str.substr(dot_pos + 1);
+auto Table::get_predicate(
+    const std::string& comparison_operator,
+    const std::string& condition_column_name,
+    const std::string& condition_column_value
+) const -> Predicate {
+    const auto column_index = resolve_column_index(condition_column_name);
+    if (column_index == -1) return {};
+
+    return {columns.at(column_index), comparison_operator, condition_column_value};
+}
+
+auto Table::find_positions(const std::vector<std::size_t>& specific_row_ids) const -> std::vector<std::size_t> {
+    auto positions = std::vector<std::size_t>{};
+    positions.reserve(specific_row_ids.size());
+
+    for (const auto row_id : specific_row_ids) {
+        const auto it = std::ranges::lower_bound(row_ids, row_id);
+        if (it != row_ids.end() && *it == row_id) positions.push_back(it - row_ids.begin());
+    }
 
-    return std::pair{left, right};
+    return positions;
 }
\ No newline at end of file
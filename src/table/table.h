@@ -1,10 +1,17 @@
 #pragma once
 
-#include <regex>
+#include <optional>
+#include <ranges>
 #include <stdexcept>
 #include <string>
 #include <vector>
 
+#include "column.h"
+#include "columnsummary.h"
+#include "predicate.h"
+#include "../index/hashindex.h"
+#include "../index/orderedindex.h"
+#include "../enums/accesspath.h"
 #include "../enums/columntype.h"
 #include "../enums/constraint.h"
 
@@ -15,7 +22,12 @@ public:
     std::vector<ColumnType> column_types;
     std::vector<std::vector<Constraint>> column_constraints;
     std::vector<std::pair<Table*, std::string>> column_foreign_keys;
-    std::vector<std::vector<std::string>> rows;
+    std::vector<Column> columns;
+    std::vector<std::size_t> row_ids;
+    std::vector<std::optional<HashIndex>> unique_indexes;
+    std::vector<std::optional<OrderedIndex>> ordered_indexes;
+    std::vector<ColumnSummary> column_summaries;
+    std::size_t next_row_id = 0;
 
     Table() = default;
 
@@ -28,24 +40,54 @@ public:
           column_names(column_names),
           column_types(column_types),
           column_constraints(column_constraints),
-          column_foreign_keys(column_foreign_keys) {}
+          column_foreign_keys(column_foreign_keys) {
+        for (int i = 0; i < column_types.size(); i++) {
+            columns.emplace_back(column_types.at(i));
+            unique_indexes.emplace_back();
+            ordered_indexes.emplace_back();
+            column_summaries.emplace_back();
+            if (has_unique_constraint(i)) unique_indexes.back().emplace(column_types.at(i));
+        }
+    }
 
     auto insert_row(const std::vector<std::string>& data) -> void;
 
-    [[nodiscard]] auto get_all_data() const -> std::vector<std::vector<std::string>>;
+    auto insert_rows(const std::vector<std::vector<std::string>>& rows) -> std::size_t;
 
-    [[nodiscard]] auto get_all_data_from(
-        const std::vector<std::string>& column_names,
-        const std::vector<std::vector<std::string>>& rows
+    auto insert_rows(const std::vector<std::string_view>& fields) -> std::size_t;
+
+    [[nodiscard]] auto row_count() const -> std::size_t;
+
+    [[nodiscard]] auto get_row(std::size_t position) const -> std::vector<std::string>;
+
+    [[nodiscard]] auto positions() const -> std::ranges::iota_view<std::size_t, std::size_t>;
+
+    [[nodiscard]] auto get_data_from(const std::vector<int>& column_indices) const -> std::vector<std::vector<std::string>>;
+
+    [[nodiscard]] auto get_data_from(
+        const std::vector<int>& column_indices,
+        const std::vector<std::size_t>& positions
     ) const -> std::vector<std::vector<std::string>>;
 
-    [[nodiscard]] auto get_data_filtered_by(
+    [[nodiscard]] auto get_positions_filtered_by(
         const std::string& comparison_operator,
-        const std::vector<std::vector<std::string>>& data,
-        const std::vector<std::string>& column_names,
         const std::string& condition_column_name,
         const std::string& condition_column_value
-    ) const -> std::vector<std::vector<std::string>>;
+    ) const -> std::vector<std::size_t>;
+
+    [[nodiscard]] auto get_access_path(
+        const std::string& comparison_operator,
+        const std::string& condition_column_name,
+        const std::string& condition_column_value
+    ) const -> AccessPath;
+
+    [[nodiscard]] auto get_positions_ordered_by(int column_index) const -> std::optional<std::vector<std::size_t>>;
+
+    [[nodiscard]] auto get_predicate(
+        const std::string& comparison_operator,
+        const std::string& condition_column_name,
+        const std::string& condition_column_value
+    ) const -> Predicate;
 
     auto add_column(
         const std::string& column_name,
@@ -56,27 +98,33 @@ public:
 
     auto remove_column(const std::string& column_name) -> void;
 
+    auto create_unique_index(int column_index) -> bool;
+
+    auto create_ordered_index(const std::string& column_name) -> void;
+
+    auto drop_ordered_index(const std::string& column_name) -> void;
+
+    auto create_dictionary(const std::string& column_name) -> void;
+
+    auto drop_dictionary(const std::string& column_name) -> void;
+
+    [[nodiscard]] auto has_unique_constraint(int column_index) const -> bool;
+
+    [[nodiscard]] auto is_indexed(const std::string& column_name) const -> bool;
+
     static auto find_index(const std::vector<std::string>& vec, const std::string& value) -> int;
 
     auto update_all_rows(const std::string& column_name, const std::string& new_value) -> void;
 
     auto update_specific_rows(
-        const std::vector<std::vector<std::string>>& specific_rows,
+        const std::vector<std::size_t>& specific_row_ids,
         const std::vector<std::vector<std::string>>& columns_and_new_values
     ) -> void;
 
     auto delete_all_rows() -> void;
 
-    auto delete_specific_rows(const std::vector<std::vector<std::string>>& specific_rows) -> void;
+    auto delete_specific_rows(const std::vector<std::size_t>& specific_row_ids) -> void;
 private:
-    static auto compare_values(
-        const std::string& value1,
-        const std::string& value2,
-        const ColumnType& type
-    ) -> int;
-
-    static auto matches_pattern(const std::string& value, const std::string& pattern) -> bool;
-
     [[nodiscard]] auto validate_column_index_and_value(
         const std::string& column_name,
         const std::string& condition_column_name,
@@ -86,21 +134,21 @@ private:
     auto validate_constraints(
         const std::string& column_name,
         int column_index,
-        const std::vector<std::string>& row,
+        std::size_t position,
         const std::string& new_value
     ) -> bool;
 
-    static auto validate_value(const std::string& value, const ColumnType& column_type, const std::string& column_name) -> bool;
+    static auto validate_value(
+        std::string_view value,
+        const ColumnType& column_type,
+        const std::string& column_name,
+        ParsedValue& parsed_value
+    ) -> bool;
 
-    [[nodiscard]] auto find_indices(const std::vector<std::string>& vec, const std::string& value) const -> std::vector<int>;
+    auto append_row(const std::vector<std::string>& data, const std::vector<ParsedValue>& parsed_values) -> void;
 
-    auto filter_data(
-        const std::vector<std::vector<std::string>>& data,
-        const std::vector<std::string>& column_names,
-        const std::string& condition_column_name,
-        const std::function<bool(const std::string&, int)>& condition
-    ) const -> std::vector<std::vector<std::string>>;
+    [[nodiscard]] auto resolve_column_index(const std::string& column_name) const -> int;
 
-    static auto split_string_with_dot(const std::string &str) -> std::pair<std::string, std::string>;
+    [[nodiscard]] auto find_positions(const std::vector<std::size_t>& specific_row_ids) const -> std::vector<std::size_t>;
 };
 